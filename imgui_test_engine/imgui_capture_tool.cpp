@@ -13,7 +13,10 @@
 Index of this file:
 
 // [SECTION] Includes
+// [SECTION] ImGuiCaptureImageOps
 // [SECTION] ImGuiCaptureImageBuf
+// [SECTION] ImGuiCaptureImageCompare
+// [SECTION] ImGuiCaptureImageWriter
 // [SECTION] ImGuiCaptureContext
 // [SECTION] ImGuiCaptureToolUI
 
@@ -33,98 +36,1890 @@ Index of this file:
 #include "imgui_capture_tool.h"
 #include "imgui_te_utils.h"         // ImPathFindFilename, ImPathFindExtension, ImPathFixSeparatorsForCurrentOS, ImFileCreateDirectoryChain, ImOsOpenInShell
 #include "thirdparty/Str/Str.h"
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+//-----------------------------------------------------------------------------
+// [SECTION] Link stb_image_write.h
+//-----------------------------------------------------------------------------
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+// Compile time options:
+//#define IMGUI_STB_NAMESPACE            ImStb
+//#define IMGUI_STB_IMAGE_WRITE_FILENAME "my_folder/stb_image_write.h"
+//#define IMGUI_DISABLE_STB_IMAGE_WRITE_IMPLEMENTATION
+
+// stb_image_write
+#ifdef _MSC_VER
+#pragma warning (push)
+#pragma warning (disable: 4456)                             // declaration of 'xx' hides previous local declaration
+#pragma warning (disable: 4457)                             // declaration of 'xx' hides function parameter
+#else
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#endif
+
+#ifdef IMGUI_STB_NAMESPACE
+namespace IMGUI_STB_NAMESPACE
+{
+#endif
+#ifndef STB_IMAGE_WRITE_IMPLEMENTATION                       // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
+#ifndef IMGUI_DISABLE_STB_IMAGE_WRITE_IMPLEMENTATION         // in case the user already have an implementation in another compilation unit
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#endif
+#ifdef IMGUI_STB_IMAGE_WRITE_FILENAME
+#include IMGUI_STB_IMAGE_WRITE_FILENAME
+#else
+#include "thirdparty/stb/imstb_image_write.h"
+#endif  // #ifdef IMGUI_STB_IMAGE_WRITE_FILENAME
+#endif  // #ifndef STB_IMAGE_WRITE_IMPLEMENTATION
+#ifdef IMGUI_STB_NAMESPACE
+} // namespace ImStb
+using namespace IMGUI_STB_NAMESPACE;
+#endif
+
+#ifdef _MSC_VER
+#pragma warning (pop)
+#else
+#pragma GCC diagnostic pop
+#endif
+
+#endif // #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiCaptureImageOps
+// Pixel operations on RGBA8 buffers. Vectorized with SSE2 (+ AVX2 when compiled with -mavx2 or /arch:AVX2) or NEON.
+// Remaining pixels and other targets use the scalar path, which also serves as reference implementation.
+//-----------------------------------------------------------------------------
+
+#if !defined(IMGUI_DISABLE_SSE) && (defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_CAPTURE_ENABLE_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define IMGUI_CAPTURE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define IMGUI_CAPTURE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+// Exact round(c * a / 255) for c, a in 0..255
+static inline unsigned int ImGuiCaptureImageOps_MulDiv255(unsigned int c, unsigned int a)
+{
+    unsigned int t = c * a + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+void ImGuiCaptureImageOps_FillAlpha(unsigned int* pixels, size_t count, unsigned char alpha)
+{
+    const unsigned int alpha_bits = (unsigned int)alpha << IM_COL32_A_SHIFT;
+    size_t n = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_AVX2)
+    const __m256i rgb_mask_256 = _mm256_set1_epi32((int)~IM_COL32_A_MASK);
+    const __m256i alpha_256 = _mm256_set1_epi32((int)alpha_bits);
+    for (; n + 8 <= count; n += 8)
+    {
+        __m256i p = _mm256_loadu_si256((const __m256i*)(pixels + n));
+        _mm256_storeu_si256((__m256i*)(pixels + n), _mm256_or_si256(_mm256_and_si256(p, rgb_mask_256), alpha_256));
+    }
+#endif
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+    const __m128i rgb_mask = _mm_set1_epi32((int)~IM_COL32_A_MASK);
+    const __m128i alpha_128 = _mm_set1_epi32((int)alpha_bits);
+    for (; n + 4 <= count; n += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i*)(pixels + n));
+        _mm_storeu_si128((__m128i*)(pixels + n), _mm_or_si128(_mm_and_si128(p, rgb_mask), alpha_128));
+    }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+    const uint32x4_t rgb_mask = vdupq_n_u32(~IM_COL32_A_MASK);
+    const uint32x4_t alpha_128 = vdupq_n_u32(alpha_bits);
+    for (; n + 4 <= count; n += 4)
+        vst1q_u32(pixels + n, vorrq_u32(vandq_u32(vld1q_u32(pixels + n), rgb_mask), alpha_128));
+#endif
+    for (; n < count; n++)
+        pixels[n] = (pixels[n] & ~IM_COL32_A_MASK) | alpha_bits;
+}
+
+void ImGuiCaptureImageOps_SwizzleRB(unsigned int* dst, const unsigned int* src, size_t count)
+{
+    size_t n = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_AVX2)
+    const __m256i shuffle_256 = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for (; n + 8 <= count; n += 8)
+        _mm256_storeu_si256((__m256i*)(dst + n), _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + n)), shuffle_256));
+#endif
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+    // No byte shuffle in SSE2: keep G/A bytes, move R/B with 16-bit shifts.
+    const __m128i ga_mask = _mm_set1_epi32((int)0xFF00FF00);
+    const __m128i b_mask = _mm_set1_epi32(0x000000FF);
+    for (; n + 4 <= count; n += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i*)(src + n));
+        __m128i ga = _mm_and_si128(p, ga_mask);
+        __m128i r_to_b = _mm_and_si128(_mm_srli_epi32(p, 16), b_mask);
+        __m128i b_to_r = _mm_slli_epi32(_mm_and_si128(p, b_mask), 16);
+        _mm_storeu_si128((__m128i*)(dst + n), _mm_or_si128(ga, _mm_or_si128(r_to_b, b_to_r)));
+    }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+    for (; n + 16 <= count; n += 16)
+    {
+        uint8x16x4_t p = vld4q_u8((const uint8_t*)(src + n));
+        uint8x16_t tmp = p.val[0];
+        p.val[0] = p.val[2];
+        p.val[2] = tmp;
+        vst4q_u8((uint8_t*)(dst + n), p);
+    }
+#endif
+    for (; n < count; n++)
+    {
+        const unsigned int p = src[n];
+        dst[n] = (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+    }
+}
+
+void ImGuiCaptureImageOps_Premultiply(unsigned int* dst, const unsigned int* src, size_t count)
+{
+    size_t n = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i alpha_mask = _mm_set1_epi32((int)IM_COL32_A_MASK);
+    for (; n + 4 <= count; n += 4)
+    {
+        const __m128i p = _mm_loadu_si128((const __m128i*)(src + n));
+        __m128i lo = _mm_unpacklo_epi8(p, zero);    // 2 pixels as 16-bit lanes
+        __m128i hi = _mm_unpackhi_epi8(p, zero);
+        __m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, a_lo), bias);
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, a_hi), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        const __m128i rgb = _mm_andnot_si128(alpha_mask, _mm_packus_epi16(lo, hi));
+        _mm_storeu_si128((__m128i*)(dst + n), _mm_or_si128(rgb, _mm_and_si128(p, alpha_mask)));
+    }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+    for (; n + 8 <= count; n += 8)
+    {
+        uint8x8x4_t p = vld4_u8((const uint8_t*)(src + n));
+        for (int c = 0; c < 3; c++)
+        {
+            uint16x8_t t = vmull_u8(p.val[c], p.val[3]);
+            p.val[c] = vraddhn_u16(t, vrshrq_n_u16(t, 8));
+        }
+        vst4_u8((uint8_t*)(dst + n), p);
+    }
+#endif
+    for (; n < count; n++)
+    {
+        const unsigned int p = src[n];
+        const unsigned int a = (p >> IM_COL32_A_SHIFT) & 0xFF;
+        const unsigned int r = ImGuiCaptureImageOps_MulDiv255((p >> IM_COL32_R_SHIFT) & 0xFF, a);
+        const unsigned int g = ImGuiCaptureImageOps_MulDiv255((p >> IM_COL32_G_SHIFT) & 0xFF, a);
+        const unsigned int b = ImGuiCaptureImageOps_MulDiv255((p >> IM_COL32_B_SHIFT) & 0xFF, a);
+        dst[n] = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (p & IM_COL32_A_MASK);
+    }
+}
+
+// Swap rows in place, without a temporary line buffer.
+void ImGuiCaptureImageOps_FlipVertical(unsigned int* pixels, int w, int h, int stride)
+{
+    for (int y = 0; y < h / 2; y++)
+    {
+        unsigned int* line_a = pixels + (size_t)y * stride;
+        unsigned int* line_b = pixels + (size_t)(h - 1 - y) * stride;
+        int x = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_AVX2)
+        for (; x + 8 <= w; x += 8)
+        {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(line_a + x));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(line_b + x));
+            _mm256_storeu_si256((__m256i*)(line_a + x), b);
+            _mm256_storeu_si256((__m256i*)(line_b + x), a);
+        }
+#endif
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+        for (; x + 4 <= w; x += 4)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*)(line_a + x));
+            __m128i b = _mm_loadu_si128((const __m128i*)(line_b + x));
+            _mm_storeu_si128((__m128i*)(line_a + x), b);
+            _mm_storeu_si128((__m128i*)(line_b + x), a);
+        }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+        for (; x + 4 <= w; x += 4)
+        {
+            uint32x4_t a = vld1q_u32(line_a + x);
+            uint32x4_t b = vld1q_u32(line_b + x);
+            vst1q_u32(line_a + x, b);
+            vst1q_u32(line_b + x, a);
+        }
+#endif
+        for (; x < w; x++)
+            ImSwap(line_a[x], line_b[x]);
+    }
+}
+
+// Rows are copied with memcpy(), which C libraries already vectorize.
+void ImGuiCaptureImageOps_Blit(unsigned int* dst, int dst_stride, const unsigned int* src, int src_stride, int w, int h)
+{
+    const size_t row_size = (size_t)w * 4;
+    if (dst_stride == w && src_stride == w)
+    {
+        memcpy(dst, src, row_size * (size_t)h);
+        return;
+    }
+    for (int y = 0; y < h; y++)
+        memcpy(dst + (size_t)y * dst_stride, src + (size_t)y * src_stride, row_size);
+}
+
+// Average each factor*factor block of source pixels. Vectorized for factor 2, the common case for thumbnails.
+void ImGuiCaptureImageOps_DownscaleBox(unsigned int* dst, int dst_stride, const unsigned int* src, int src_stride, int src_w, int src_h, int factor)
+{
+    IM_ASSERT(factor >= 1);
+    const int dst_w = src_w / factor;
+    const int dst_h = src_h / factor;
+    if (factor == 1)
+    {
+        ImGuiCaptureImageOps_Blit(dst, dst_stride, src, src_stride, dst_w, dst_h);
+        return;
+    }
+    const unsigned int area = (unsigned int)(factor * factor);
+    for (int y = 0; y < dst_h; y++)
+    {
+        const unsigned int* row0 = src + (size_t)y * factor * src_stride;
+        unsigned int* dst_row = dst + (size_t)y * dst_stride;
+        int x = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2) || defined(IMGUI_CAPTURE_ENABLE_NEON)
+        if (factor == 2)
+        {
+            const unsigned int* row1 = row0 + src_stride;
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i bias = _mm_set1_epi16(2);
+            for (; x + 2 <= dst_w; x += 2)
+            {
+                __m128i p0 = _mm_loadu_si128((const __m128i*)(row0 + x * 2));
+                __m128i p1 = _mm_loadu_si128((const __m128i*)(row1 + x * 2));
+                __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(p0, zero), _mm_unpacklo_epi8(p1, zero)); // Pixels 0,1 (both rows)
+                __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(p0, zero), _mm_unpackhi_epi8(p1, zero)); // Pixels 2,3 (both rows)
+                lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+                hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+                __m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), bias), 2);
+                _mm_storel_epi64((__m128i*)(dst_row + x), _mm_packus_epi16(sum, zero));
+            }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+            for (; x + 8 <= dst_w; x += 8)
+            {
+                uint8x16x4_t p0 = vld4q_u8((const uint8_t*)(row0 + x * 2));
+                uint8x16x4_t p1 = vld4q_u8((const uint8_t*)(row1 + x * 2));
+                uint8x8x4_t out;
+                for (int c = 0; c < 4; c++)
+                    out.val[c] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(p0.val[c]), vpaddlq_u8(p1.val[c])), 2);
+                vst4_u8((uint8_t*)(dst_row + x), out);
+            }
+#endif
+        }
+#endif
+        for (; x < dst_w; x++)
+        {
+            unsigned int sum[4] = { 0, 0, 0, 0 };
+            for (int sy = 0; sy < factor; sy++)
+            {
+                const unsigned int* p = row0 + (size_t)sy * src_stride + (size_t)x * factor;
+                for (int sx = 0; sx < factor; sx++)
+                    for (int c = 0; c < 4; c++)
+                        sum[c] += (p[sx] >> (c * 8)) & 0xFF;
+            }
+            unsigned int out = 0;
+            for (int c = 0; c < 4; c++)
+                out |= ((sum[c] + area / 2) / area) << (c * 8);
+            dst_row[x] = out;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiCaptureImageBuf
+// Helper class for simple bitmap manipulation
+//-----------------------------------------------------------------------------
+
+void ImGuiCaptureImageBuf::Clear()
+{
+    if (Data)
+        IM_FREE(Data);
+    Data = NULL;
+}
+
+void ImGuiCaptureImageBuf::CreateEmpty(int w, int h)
+{
+    // Reuse allocation when size doesn't change (e.g. consecutive captures of same area)
+    if (Data == NULL || Width != w || Height != h)
+    {
+        Clear();
+        Width = w;
+        Height = h;
+        Data = (unsigned int*)IM_ALLOC((size_t)Width * (size_t)Height * 4);
+    }
+    memset(Data, 0, (size_t)Width * (size_t)Height * 4);
+}
+
+void ImGuiCaptureImageBuf::CreateFromCrop(const ImGuiCaptureImageBuf* src, int x, int y, int w, int h)
+{
+    IM_ASSERT(src != this && src->Data != NULL);
+    IM_ASSERT(x >= 0 && y >= 0 && x + w <= src->Width && y + h <= src->Height);
+    CreateEmpty(w, h);
+    ImGuiCaptureImageOps_Blit(Data, Width, src->Data + (size_t)y * src->Width + x, src->Width, w, h);
+}
+
+void ImGuiCaptureImageBuf::CreateDownscaled(const ImGuiCaptureImageBuf* src, int factor)
+{
+    IM_ASSERT(src != this && src->Data != NULL && factor >= 1);
+    CreateEmpty(src->Width / factor, src->Height / factor);
+    ImGuiCaptureImageOps_DownscaleBox(Data, Width, src->Data, src->Width, src->Width, src->Height, factor);
+}
+
+//-----------------------------------------------------------------------------
+// Minimal PNG decoder, used to load golden images. We only vendor stb_image_write.h, so this implements the subset
+// written by it and by common tools: 8-bit gray/gray+alpha/RGB/RGBA, non-interlaced. Inflate is derived from zlib's puff.c.
+//-----------------------------------------------------------------------------
+
+struct ImGuiCapturePngInflate
+{
+    const unsigned char*    Src;
+    size_t                  SrcSize;
+    size_t                  SrcPos;
+    unsigned int            BitBuf;
+    int                     BitCount;
+    ImVector<unsigned char>* Out;
+    size_t                  OutMax;             // Fail when decompressed data would exceed this size
+    bool                    Error;
+};
+
+struct ImGuiCapturePngHuffman
+{
+    short                   Count[16];          // Number of symbols of each length
+    short                   Symbol[288];        // Symbols ordered by code
+};
+
+static int ImGuiCapturePngInflate_Bits(ImGuiCapturePngInflate* s, int need)
+{
+    unsigned int val = s->BitBuf;
+    while (s->BitCount < need)
+    {
+        if (s->SrcPos == s->SrcSize)
+        {
+            s->Error = true;
+            return 0;
+        }
+        val |= (unsigned int)s->Src[s->SrcPos++] << s->BitCount;
+        s->BitCount += 8;
+    }
+    s->BitBuf = (unsigned int)(val >> need);
+    s->BitCount -= need;
+    return (int)(val & ((1u << need) - 1));
+}
+
+static int ImGuiCapturePngInflate_Decode(ImGuiCapturePngInflate* s, const ImGuiCapturePngHuffman* h)
+{
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++)
+    {
+        code |= ImGuiCapturePngInflate_Bits(s, 1);
+        const int count = h->Count[len];
+        if (code - count < first)
+            return h->Symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    s->Error = true;
+    return -1;
+}
+
+static bool ImGuiCapturePngHuffman_Build(ImGuiCapturePngHuffman* h, const short* lengths, int n)
+{
+    memset(h->Count, 0, sizeof(h->Count));
+    for (int symbol = 0; symbol < n; symbol++)
+        h->Count[lengths[symbol]]++;
+    int left = 1;
+    for (int len = 1; len < 16; len++)
+    {
+        left <<= 1;
+        left -= h->Count[len];
+        if (left < 0)
+            return false;           // Over-subscribed
+    }
+    short offs[16];
+    offs[1] = 0;
+    for (int len = 1; len < 15; len++)
+        offs[len + 1] = offs[len] + h->Count[len];
+    for (int symbol = 0; symbol < n; symbol++)
+        if (lengths[symbol] != 0)
+            h->Symbol[offs[lengths[symbol]]++] = (short)symbol;
+    return true;
+}
+
+static bool ImGuiCapturePngInflate_Codes(ImGuiCapturePngInflate* s, const ImGuiCapturePngHuffman* lencode, const ImGuiCapturePngHuffman* distcode)
+{
+    static const short len_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const short len_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short dist_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short dist_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    ImVector<unsigned char>* out = s->Out;
+    while (!s->Error)
+    {
+        int symbol = ImGuiCapturePngInflate_Decode(s, lencode);
+        if (symbol < 0)
+            return false;
+        if (symbol < 256)
+        {
+            if ((size_t)out->Size + 1 > s->OutMax)
+                return false;
+            out->push_back((unsigned char)symbol);
+            continue;
+        }
+        if (symbol == 256)
+            return true;
+        symbol -= 257;
+        if (symbol >= 29)
+            return false;
+        const int len = len_base[symbol] + ImGuiCapturePngInflate_Bits(s, len_extra[symbol]);
+        symbol = ImGuiCapturePngInflate_Decode(s, distcode);
+        if (symbol < 0 || symbol >= 30)
+            return false;
+        const int dist = dist_base[symbol] + ImGuiCapturePngInflate_Bits(s, dist_extra[symbol]);
+        if (dist > out->Size || (size_t)out->Size + (size_t)len > s->OutMax)
+            return false;
+        const int copy_from = out->Size - dist;
+        out->reserve(out->Size + len);
+        for (int n = 0; n < len; n++)
+            out->push_back((*out)[copy_from + n]);
+    }
+    return false;
+}
+
+static bool ImGuiCapturePngInflate_Run(ImGuiCapturePngInflate* s)
+{
+    ImGuiCapturePngHuffman lencode, distcode;
+    short lengths[320];
+    int last = 0;
+    while (!last)
+    {
+        last = ImGuiCapturePngInflate_Bits(s, 1);
+        const int type = ImGuiCapturePngInflate_Bits(s, 2);
+        if (s->Error)
+            return false;
+        if (type == 0)
+        {
+            // Stored block
+            s->BitBuf = 0;
+            s->BitCount = 0;
+            if (s->SrcPos + 4 > s->SrcSize)
+                return false;
+            const unsigned int len = s->Src[s->SrcPos] | (s->Src[s->SrcPos + 1] << 8);
+            const unsigned int len_complement = s->Src[s->SrcPos + 2] | (s->Src[s->SrcPos + 3] << 8);
+            s->SrcPos += 4;
+            if (len != (~len_complement & 0xFFFF) || s->SrcPos + len > s->SrcSize || (size_t)s->Out->Size + len > s->OutMax)
+                return false;
+            const int out_size = s->Out->Size;
+            s->Out->resize(out_size + (int)len);
+            memcpy(s->Out->Data + out_size, s->Src + s->SrcPos, len);
+            s->SrcPos += len;
+        }
+        else if (type == 1)
+        {
+            // Fixed Huffman codes
+            int symbol = 0;
+            for (; symbol < 144; symbol++) lengths[symbol] = 8;
+            for (; symbol < 256; symbol++) lengths[symbol] = 9;
+            for (; symbol < 280; symbol++) lengths[symbol] = 7;
+            for (; symbol < 288; symbol++) lengths[symbol] = 8;
+            ImGuiCapturePngHuffman_Build(&lencode, lengths, 288);
+            for (symbol = 0; symbol < 30; symbol++) lengths[symbol] = 5;
+            ImGuiCapturePngHuffman_Build(&distcode, lengths, 30);
+            if (!ImGuiCapturePngInflate_Codes(s, &lencode, &distcode))
+                return false;
+        }
+        else if (type == 2)
+        {
+            // Dynamic Huffman codes
+            static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+            const int nlen = ImGuiCapturePngInflate_Bits(s, 5) + 257;
+            const int ndist = ImGuiCapturePngInflate_Bits(s, 5) + 1;
+            const int ncode = ImGuiCapturePngInflate_Bits(s, 4) + 4;
+            if (s->Error || nlen > 286 || ndist > 30)
+                return false;
+            int index = 0;
+            for (; index < ncode; index++)
+                lengths[order[index]] = (short)ImGuiCapturePngInflate_Bits(s, 3);
+            for (; index < 19; index++)
+                lengths[order[index]] = 0;
+            if (!ImGuiCapturePngHuffman_Build(&lencode, lengths, 19))
+                return false;
+            index = 0;
+            while (index < nlen + ndist)
+            {
+                int symbol = ImGuiCapturePngInflate_Decode(s, &lencode);
+                if (symbol < 0)
+                    return false;
+                if (symbol < 16)
+                {
+                    lengths[index++] = (short)symbol;
+                    continue;
+                }
+                short len = 0;
+                if (symbol == 16)
+                {
+                    if (index == 0)
+                        return false;
+                    len = lengths[index - 1];
+                    symbol = 3 + ImGuiCapturePngInflate_Bits(s, 2);
+                }
+                else if (symbol == 17)
+                    symbol = 3 + ImGuiCapturePngInflate_Bits(s, 3);
+                else
+                    symbol = 11 + ImGuiCapturePngInflate_Bits(s, 7);
+                if (index + symbol > nlen + ndist)
+                    return false;
+                while (symbol--)
+                    lengths[index++] = len;
+            }
+            if (lengths[256] == 0)
+                return false;
+            if (!ImGuiCapturePngHuffman_Build(&lencode, lengths, nlen) || !ImGuiCapturePngHuffman_Build(&distcode, lengths + nlen, ndist))
+                return false;
+            if (!ImGuiCapturePngInflate_Codes(s, &lencode, &distcode))
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return !s->Error;
+}
+
+static unsigned int ImGuiCapturePng_ReadU32(const unsigned char* p)
+{
+    return ((unsigned int)p[0] << 24) | ((unsigned int)p[1] << 16) | ((unsigned int)p[2] << 8) | (unsigned int)p[3];
+}
+
+static int ImGuiCapturePng_Paeth(int a, int b, int c)
+{
+    const int p = a + b - c;
+    const int pa = ImAbs(p - a), pb = ImAbs(p - b), pc = ImAbs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    return (pb <= pc) ? b : c;
+}
+
+// Decode PNG file contents into RGBA8 pixels allocated with IM_ALLOC().
+// Images are limited to IMGUI_CAPTURE_PNG_MAX_PIXELS, so sizes computed below cannot overflow and corrupt files cannot request huge allocations.
+static const size_t IMGUI_CAPTURE_PNG_MAX_PIXELS = 64 * 1024 * 1024;
+
+static unsigned int* ImGuiCapturePng_Decode(const unsigned char* data, size_t data_size, int* out_w, int* out_h)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if (data_size < 8 || memcmp(data, signature, 8) != 0)
+        return NULL;
+
+    // Gather IDAT chunks
+    int w = 0, h = 0, channels = 0;
+    ImVector<unsigned char> compressed;
+    for (size_t pos = 8; pos + 12 <= data_size; )
+    {
+        const unsigned int chunk_size = ImGuiCapturePng_ReadU32(data + pos);
+        const unsigned char* chunk_type = data + pos + 4;
+        const unsigned char* chunk_data = data + pos + 8;
+        if (chunk_size > data_size - pos - 12)
+            return NULL;
+        if (memcmp(chunk_type, "IHDR", 4) == 0)
+        {
+            if (chunk_size < 13)
+                return NULL;
+            w = (int)ImGuiCapturePng_ReadU32(chunk_data);
+            h = (int)ImGuiCapturePng_ReadU32(chunk_data + 4);
+            const int bit_depth = chunk_data[8], color_type = chunk_data[9], interlace = chunk_data[12];
+            channels = (color_type == 0) ? 1 : (color_type == 2) ? 3 : (color_type == 4) ? 2 : (color_type == 6) ? 4 : 0;
+            if (bit_depth != 8 || channels == 0 || interlace != 0 || w <= 0 || h <= 0 || w > 0x8000 || h > 0x8000)
+                return NULL;
+            if ((size_t)w * (size_t)h > IMGUI_CAPTURE_PNG_MAX_PIXELS)
+                return NULL;
+        }
+        else if (memcmp(chunk_type, "IDAT", 4) == 0)
+        {
+            if ((size_t)compressed.Size + chunk_size > IMGUI_CAPTURE_PNG_MAX_PIXELS * 4)
+                return NULL;
+            const int offset = compressed.Size;
+            compressed.resize(offset + (int)chunk_size);
+            memcpy(compressed.Data + offset, chunk_data, chunk_size);
+        }
+        else if (memcmp(chunk_type, "IEND", 4) == 0)
+        {
+            break;
+        }
+        pos += 12 + chunk_size;
+    }
+    if (channels == 0 || compressed.Size < 2)
+        return NULL;
+
+    // Inflate (skip 2 bytes zlib header, ignore adler32 checksum)
+    const int stride = w * channels;
+    const size_t raw_size = ((size_t)stride + 1) * (size_t)h;
+    ImVector<unsigned char> raw;
+    raw.reserve((int)raw_size);
+    ImGuiCapturePngInflate inflate = { compressed.Data + 2, (size_t)compressed.Size - 2, 0, 0, 0, &raw, raw_size, false };
+    if ((compressed[0] & 0x0F) != 8 || !ImGuiCapturePngInflate_Run(&inflate) || (size_t)raw.Size < raw_size)
+        return NULL;
+
+    // Unfilter in place, then expand to RGBA
+    for (int y = 0; y < h; y++)
+    {
+        unsigned char* line = raw.Data + (size_t)y * (stride + 1);
+        const int filter = line[0];
+        unsigned char* cur = line + 1;
+        const unsigned char* prev = (y > 0) ? cur - (stride + 1) : NULL;
+        for (int i = 0; i < stride; i++)
+        {
+            const int a = (i >= channels) ? cur[i - channels] : 0;
+            const int b = prev ? prev[i] : 0;
+            const int c = (prev && i >= channels) ? prev[i - channels] : 0;
+            switch (filter)
+            {
+            case 0: break;
+            case 1: cur[i] = (unsigned char)(cur[i] + a); break;
+            case 2: cur[i] = (unsigned char)(cur[i] + b); break;
+            case 3: cur[i] = (unsigned char)(cur[i] + ((a + b) >> 1)); break;
+            case 4: cur[i] = (unsigned char)(cur[i] + ImGuiCapturePng_Paeth(a, b, c)); break;
+            default: return NULL;
+            }
+        }
+    }
+    unsigned int* pixels = (unsigned int*)IM_ALLOC((size_t)w * (size_t)h * 4);
+    for (int y = 0; y < h; y++)
+    {
+        const unsigned char* src = raw.Data + (size_t)y * (stride + 1) + 1;
+        unsigned char* dst = (unsigned char*)(pixels + (size_t)y * w);
+        for (int x = 0; x < w; x++, src += channels, dst += 4)
+        {
+            switch (channels)
+            {
+            case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 0xFF; break;
+            case 2: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+            case 3: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 0xFF; break;
+            case 4: memcpy(dst, src, 4); break;
+            }
+        }
+    }
+    *out_w = w;
+    *out_h = h;
+    return pixels;
+}
+
+//-----------------------------------------------------------------------------
+// QOI ("Quite OK Image") encoder/decoder, see https://qoiformat.org/qoi-specification.pdf
+// Lossless and an order of magnitude faster to encode than PNG, at the cost of larger files: useful when capture
+// throughput matters more than file size. Use ImGuiCaptureContext::ConvertImageFilesToPng() to publish them.
+//-----------------------------------------------------------------------------
+
+enum ImGuiCaptureQoiOp
+{
+    ImGuiCaptureQoiOp_Index     = 0x00, // 00xxxxxx
+    ImGuiCaptureQoiOp_Diff      = 0x40, // 01xxxxxx
+    ImGuiCaptureQoiOp_Luma      = 0x80, // 10xxxxxx
+    ImGuiCaptureQoiOp_Run       = 0xC0, // 11xxxxxx
+    ImGuiCaptureQoiOp_RGB       = 0xFE,
+    ImGuiCaptureQoiOp_RGBA      = 0xFF,
+    ImGuiCaptureQoiOp_Mask2     = 0xC0
+};
+
+static const unsigned char  IMGUI_CAPTURE_QOI_MAGIC[4] = { 'q', 'o', 'i', 'f' };
+static const unsigned char  IMGUI_CAPTURE_QOI_END_MARKER[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+static const int            IMGUI_CAPTURE_QOI_HEADER_SIZE = 14;
+
+static inline int ImGuiCaptureQoi_Hash(const unsigned char* px)
+{
+    return (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) & 63;
+}
+
+static inline void ImGuiCaptureQoi_WriteU32BE(unsigned char* dst, unsigned int v)
+{
+    dst[0] = (unsigned char)(v >> 24); dst[1] = (unsigned char)(v >> 16); dst[2] = (unsigned char)(v >> 8); dst[3] = (unsigned char)v;
+}
+
+static inline unsigned int ImGuiCaptureQoi_ReadU32BE(const unsigned char* src)
+{
+    return ((unsigned int)src[0] << 24) | ((unsigned int)src[1] << 16) | ((unsigned int)src[2] << 8) | (unsigned int)src[3];
+}
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+// Encode RGBA8 pixels and write them to 'f' in chunks. Uses malloc() rather than IM_ALLOC() so it may be called from worker threads.
+static bool ImGuiCaptureQoi_Write(FILE* f, int w, int h, const unsigned int* data)
+{
+    const size_t CHUNK_SIZE = 64 * 1024;
+    const size_t CHUNK_MAX_OP_SIZE = 1 + 5;   // A pixel may emit a pending QOI_OP_RUN byte followed by a QOI_OP_RGBA op
+    unsigned char* chunk = (unsigned char*)malloc(CHUNK_SIZE);
+    if (chunk == NULL)
+        return false;
+    size_t pos = 0;
+    bool ok = true;
+
+    memcpy(chunk, IMGUI_CAPTURE_QOI_MAGIC, 4);
+    ImGuiCaptureQoi_WriteU32BE(chunk + 4, (unsigned int)w);
+    ImGuiCaptureQoi_WriteU32BE(chunk + 8, (unsigned int)h);
+    chunk[12] = 4;  // Channels: RGBA
+    chunk[13] = 0;  // Colorspace: sRGB with linear alpha
+    pos = IMGUI_CAPTURE_QOI_HEADER_SIZE;
+
+    unsigned char index[64][4];
+    memset(index, 0, sizeof(index));
+    unsigned char prev[4] = { 0, 0, 0, 255 };
+    int run = 0;
+    const size_t count = (size_t)w * (size_t)h;
+    const unsigned char* px = (const unsigned char*)data;
+    for (size_t n = 0; n < count; n++, px += 4)
+    {
+        if (pos + CHUNK_MAX_OP_SIZE > CHUNK_SIZE)
+        {
+            ok &= (fwrite(chunk, 1, pos, f) == pos);
+            pos = 0;
+        }
+        if (memcmp(px, prev, 4) == 0)
+        {
+            run++;
+            if (run == 62 || n + 1 == count)
+            {
+                chunk[pos++] = (unsigned char)(ImGuiCaptureQoiOp_Run | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0)
+        {
+            chunk[pos++] = (unsigned char)(ImGuiCaptureQoiOp_Run | (run - 1));
+            run = 0;
+        }
+
+        unsigned char* index_px = index[ImGuiCaptureQoi_Hash(px)];
+        if (memcmp(index_px, px, 4) == 0)
+        {
+            chunk[pos++] = (unsigned char)(ImGuiCaptureQoiOp_Index | ImGuiCaptureQoi_Hash(px));
+        }
+        else
+        {
+            memcpy(index_px, px, 4);
+            if (px[3] == prev[3])
+            {
+                const int dr = (signed char)(px[0] - prev[0]);
+                const int dg = (signed char)(px[1] - prev[1]);
+                const int db = (signed char)(px[2] - prev[2]);
+                const int dr_dg = dr - dg;
+                const int db_dg = db - dg;
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+                {
+                    chunk[pos++] = (unsigned char)(ImGuiCaptureQoiOp_Diff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2));
+                }
+                else if (dr_dg >= -8 && dr_dg <= 7 && dg >= -32 && dg <= 31 && db_dg >= -8 && db_dg <= 7)
+                {
+                    chunk[pos++] = (unsigned char)(ImGuiCaptureQoiOp_Luma | (dg + 32));
+                    chunk[pos++] = (unsigned char)(((dr_dg + 8) << 4) | (db_dg + 8));
+                }
+                else
+                {
+                    chunk[pos++] = ImGuiCaptureQoiOp_RGB;
+                    memcpy(chunk + pos, px, 3);
+                    pos += 3;
+                }
+            }
+            else
+            {
+                chunk[pos++] = ImGuiCaptureQoiOp_RGBA;
+                memcpy(chunk + pos, px, 4);
+                pos += 4;
+            }
+        }
+        memcpy(prev, px, 4);
+    }
+    if (pos + sizeof(IMGUI_CAPTURE_QOI_END_MARKER) > CHUNK_SIZE)
+    {
+        ok &= (fwrite(chunk, 1, pos, f) == pos);
+        pos = 0;
+    }
+    memcpy(chunk + pos, IMGUI_CAPTURE_QOI_END_MARKER, sizeof(IMGUI_CAPTURE_QOI_END_MARKER));
+    pos += sizeof(IMGUI_CAPTURE_QOI_END_MARKER);
+    ok &= (fwrite(chunk, 1, pos, f) == pos);
+    free(chunk);
+    return ok;
+}
+#endif
+
+// Return RGBA8 pixels allocated with IM_ALLOC(), or NULL if data is not a valid QOI image.
+static unsigned int* ImGuiCaptureQoi_Decode(const unsigned char* data, size_t data_size, int* out_w, int* out_h)
+{
+    if (data_size < IMGUI_CAPTURE_QOI_HEADER_SIZE + sizeof(IMGUI_CAPTURE_QOI_END_MARKER) || memcmp(data, IMGUI_CAPTURE_QOI_MAGIC, 4) != 0)
+        return NULL;
+    const unsigned int w = ImGuiCaptureQoi_ReadU32BE(data + 4);
+    const unsigned int h = ImGuiCaptureQoi_ReadU32BE(data + 8);
+    const int channels = data[12];
+    if (w == 0 || h == 0 || w > 0x8000 || h > 0x8000 || (channels != 3 && channels != 4))
+        return NULL;
+
+    // Reject corrupt headers before allocating: a single QOI_OP_RUN byte encodes at most 62 pixels.
+    const size_t count = (size_t)w * (size_t)h;
+    if (count > IMGUI_CAPTURE_PNG_MAX_PIXELS || count > (data_size - IMGUI_CAPTURE_QOI_HEADER_SIZE - sizeof(IMGUI_CAPTURE_QOI_END_MARKER)) * 62)
+        return NULL;
+    unsigned int* pixels = (unsigned int*)IM_ALLOC(count * 4);
+    unsigned char* dst = (unsigned char*)pixels;
+    const unsigned char* src = data + IMGUI_CAPTURE_QOI_HEADER_SIZE;
+    const unsigned char* src_end = data + data_size - sizeof(IMGUI_CAPTURE_QOI_END_MARKER);
+    unsigned char index[64][4];
+    memset(index, 0, sizeof(index));
+    unsigned char px[4] = { 0, 0, 0, 255 };
+    int run = 0;
+    for (size_t n = 0; n < count; n++, dst += 4)
+    {
+        if (run > 0)
+        {
+            run--;
+        }
+        else
+        {
+            if (src >= src_end)
+                break;
+            const int b1 = *src++;
+            if (b1 == ImGuiCaptureQoiOp_RGB || b1 == ImGuiCaptureQoiOp_RGBA)
+            {
+                const int size = (b1 == ImGuiCaptureQoiOp_RGB) ? 3 : 4;
+                if (src + size > src_end)
+                    break;
+                memcpy(px, src, (size_t)size);
+                src += size;
+            }
+            else if ((b1 & ImGuiCaptureQoiOp_Mask2) == ImGuiCaptureQoiOp_Index)
+            {
+                memcpy(px, index[b1], 4);
+            }
+            else if ((b1 & ImGuiCaptureQoiOp_Mask2) == ImGuiCaptureQoiOp_Diff)
+            {
+                px[0] = (unsigned char)(px[0] + ((b1 >> 4) & 0x03) - 2);
+                px[1] = (unsigned char)(px[1] + ((b1 >> 2) & 0x03) - 2);
+                px[2] = (unsigned char)(px[2] + (b1 & 0x03) - 2);
+            }
+            else if ((b1 & ImGuiCaptureQoiOp_Mask2) == ImGuiCaptureQoiOp_Luma)
+            {
+                if (src >= src_end)
+                    break;
+                const int b2 = *src++;
+                const int dg = (b1 & 0x3F) - 32;
+                px[0] = (unsigned char)(px[0] + dg - 8 + ((b2 >> 4) & 0x0F));
+                px[1] = (unsigned char)(px[1] + dg);
+                px[2] = (unsigned char)(px[2] + dg - 8 + (b2 & 0x0F));
+            }
+            else
+            {
+                run = (b1 & 0x3F);
+            }
+            memcpy(index[ImGuiCaptureQoi_Hash(px)], px, 4);
+        }
+        memcpy(dst, px, 4);
+    }
+    if (dst != (unsigned char*)(pixels + count))
+    {
+        IM_FREE(pixels);
+        return NULL;
+    }
+    *out_w = (int)w;
+    *out_h = (int)h;
+    return pixels;
+}
+
+bool ImGuiCaptureImageBuf::LoadFile(const char* filename)
+{
+    Clear();
+    size_t file_size = 0;
+    unsigned char* file_data = (unsigned char*)ImFileLoadToMemory(filename, "rb", &file_size);
+    if (file_data == NULL)
+        return false;
+    int w = 0, h = 0;
+    if (file_size >= 4 && memcmp(file_data, IMGUI_CAPTURE_QOI_MAGIC, 4) == 0)
+        Data = ImGuiCaptureQoi_Decode(file_data, file_size, &w, &h);
+    else
+        Data = ImGuiCapturePng_Decode(file_data, file_size, &w, &h);
+    IM_FREE(file_data);
+    Width = Data ? w : 0;
+    Height = Data ? h : 0;
+    return Data != NULL;
+}
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+struct ImGuiCapturePngSettings
+{
+    int         CompressionLevel = 8;
+    int         Filter = -1;
+};
+
+// PNG encoder settings are globals of stb_image_write.h, shared by all capture contexts and threads.
+// Encodes with same settings run concurrently, an encode with other settings waits for them to complete before changing globals.
+struct ImGuiCapturePngEncoder
+{
+    std::mutex                  Mutex;
+    std::condition_variable     IdleCond;
+    int                         EncodesInFlight = 0;
+    ImGuiCapturePngSettings     Applied = { -1, -1 };   // Always apply on first encode
+};
+
+static bool ImGuiCapturePng_WriteFile(const char* filename, int w, int h, const unsigned int* data, const ImGuiCapturePngSettings* settings)
+{
+    static ImGuiCapturePngEncoder encoder;
+    const int compression_level = ImClamp(settings->CompressionLevel, 1, 9);
+    const int filter = ImClamp(settings->Filter, -1, 4);
+    {
+        std::unique_lock<std::mutex> lock(encoder.Mutex);
+        while (encoder.EncodesInFlight > 0 && (encoder.Applied.CompressionLevel != compression_level || encoder.Applied.Filter != filter))
+            encoder.IdleCond.wait(lock);
+        stbi_write_png_compression_level = encoder.Applied.CompressionLevel = compression_level;
+        stbi_write_force_png_filter = encoder.Applied.Filter = filter;
+        encoder.EncodesInFlight++;
+    }
+    const int ret = stbi_write_png(filename, w, h, 4, data, w * 4);
+    {
+        std::lock_guard<std::mutex> lock(encoder.Mutex);
+        if (--encoder.EncodesInFlight == 0)
+            encoder.IdleCond.notify_all();
+    }
+    return ret != 0;
+}
+
+// Encode and write pixel data, format is selected by file extension (.png/.qoi/.bmp/.tga). Fail on other extensions.
+// Does not allocate with IM_ALLOC() so it may be called from worker threads.
+static bool ImGuiCaptureImageBuf_WriteFile(const char* filename, int w, int h, const unsigned int* data, const ImGuiCapturePngSettings* png_settings)
+{
+    const char* ext = ImPathFindExtension(filename);
+    int ret = 0;
+    if (ImStricmp(ext, ".qoi") == 0)
+    {
+        FILE* f = fopen(filename, "wb"); // Not ImFileOpen(), which allocates on Windows.
+        if (f == NULL)
+            return false;
+        ret = ImGuiCaptureQoi_Write(f, w, h, data);
+        ret &= (fclose(f) == 0);
+    }
+    else if (ImStricmp(ext, ".bmp") == 0)
+    {
+        ret = stbi_write_bmp(filename, w, h, 4, data);
+    }
+    else if (ImStricmp(ext, ".tga") == 0)
+    {
+        ret = stbi_write_tga(filename, w, h, 4, data);
+    }
+    else if (ImStricmp(ext, ".png") == 0)
+    {
+        ret = ImGuiCapturePng_WriteFile(filename, w, h, data, png_settings);
+    }
+    return ret != 0;
+}
+#endif
+
+bool ImGuiCaptureImageBuf::SaveFile(const char* filename)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(Data != NULL);
+    ImFileCreateDirectoryChain(filename, ImPathFindFilename(filename));
+    ImGuiCapturePngSettings png_settings;
+    return ImGuiCaptureImageBuf_WriteFile(filename, Width, Height, Data, &png_settings);
+#else
+    IM_UNUSED(filename);
+    return false;
+#endif
+}
+
+void ImGuiCaptureImageBuf::RemoveAlpha()
+{
+    ImGuiCaptureImageOps_FillAlpha(Data, (size_t)Width * (size_t)Height, 0xFF);
+}
+
+void ImGuiCaptureImageBuf::FlipVertical()
+{
+    ImGuiCaptureImageOps_FlipVertical(Data, Width, Height, Width);
+}
+
+void ImGuiCaptureImageBuf::SwizzleRB()
+{
+    ImGuiCaptureImageOps_SwizzleRB(Data, Data, (size_t)Width * (size_t)Height);
+}
+
+void ImGuiCaptureImageBuf::Premultiply()
+{
+    ImGuiCaptureImageOps_Premultiply(Data, Data, (size_t)Width * (size_t)Height);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiCaptureImageCompare
+//-----------------------------------------------------------------------------
+// Compare a captured image with a golden image:
+// - Blocks of 4 pixels are compared with SIMD instructions. Blocks where all channels are within tolerance are skipped.
+// - Each remaining pixel is classified:
+//   - ignored when inside ImGuiCaptureCompareArgs::InIgnoreRects.
+//   - anti-aliased when it matches a pixel in the 3x3 neighborhood of the other image, both ways. This absorbs
+//     small rasterization differences and sub-pixel offsets.
+//   - different otherwise.
+// - When comparison fails, a second pass paints a diff image: faded golden image, different pixels in red,
+//   anti-aliased pixels in yellow, ignored pixels in blue.
+// Does not allocate with IM_ALLOC() so it may be called from worker threads.
+//-----------------------------------------------------------------------------
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+struct ImGuiCaptureCompareState
+{
+    const unsigned int*             Image;
+    const unsigned int*             Golden;
+    int                             Width;
+    int                             Height;
+    const ImGuiCaptureCompareArgs*  Args;               // InIgnoreRects are in image coordinates at this point
+    unsigned int*                   Paint;              // Diff image being painted, or NULL
+    ImGuiCaptureCompareResult*      Result;
+};
+
+// Pixels are RGBA8 in memory regardless of IMGUI_USE_BGRA_PACKED_COLOR
+static inline unsigned int ImGuiCaptureCompare_MakeRGBA(unsigned int r, unsigned int g, unsigned int b)
+{
+    return r | (g << 8) | (b << 16) | 0xFF000000;
+}
+
+static inline int ImGuiCaptureCompare_PixelDiff(unsigned int a, unsigned int b)
+{
+    int max_diff = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        max_diff = ImMax(max_diff, ImAbs((int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF)));
+    return max_diff;
+}
+
+// Does pixel 'p' match a neighbor of (x,y) in 'other'?
+static bool ImGuiCaptureCompare_MatchNeighbor(const ImGuiCaptureCompareState* s, unsigned int p, const unsigned int* other, int x, int y)
+{
+    for (int ny = ImMax(y - 1, 0); ny <= ImMin(y + 1, s->Height - 1); ny++)
+        for (int nx = ImMax(x - 1, 0); nx <= ImMin(x + 1, s->Width - 1); nx++)
+            if ((nx != x || ny != y) && ImGuiCaptureCompare_PixelDiff(p, other[(size_t)ny * s->Width + nx]) <= s->Args->InTolerance)
+                return true;
+    return false;
+}
+
+static void ImGuiCaptureCompare_ClassifyPixel(ImGuiCaptureCompareState* s, int x, int y)
+{
+    const size_t i = (size_t)y * s->Width + x;
+    ImGuiCaptureCompareResult* result = s->Result;
+    const ImVec2 pixel_center((float)x + 0.5f, (float)y + 0.5f);
+    bool ignored = false;
+    for (const ImRect& ignore_rect : s->Args->InIgnoreRects)
+        if (ignore_rect.Contains(pixel_center))
+        {
+            ignored = true;
+            break;
+        }
+
+    unsigned int paint_col;
+    if (ignored)
+    {
+        result->PixelsIgnored++;
+        paint_col = ImGuiCaptureCompare_MakeRGBA(0, 96, 255);
+    }
+    else if (s->Args->InAntiAliasingAware && ImGuiCaptureCompare_MatchNeighbor(s, s->Image[i], s->Golden, x, y) && ImGuiCaptureCompare_MatchNeighbor(s, s->Golden[i], s->Image, x, y))
+    {
+        result->PixelsAntiAliased++;
+        paint_col = ImGuiCaptureCompare_MakeRGBA(255, 200, 0);
+    }
+    else
+    {
+        result->PixelsDifferent++;
+        result->DiffRect.Add(ImRect((float)x, (float)y, (float)(x + 1), (float)(y + 1)));
+        paint_col = ImGuiCaptureCompare_MakeRGBA(255, 0, 0);
+    }
+    if (s->Paint)
+        s->Paint[i] = paint_col;
+}
+
+static void ImGuiCaptureCompare_Run(ImGuiCaptureCompareState* s)
+{
+    ImGuiCaptureCompareResult* result = s->Result;
+    const int tolerance = s->Args->InTolerance;
+    result->PixelsDifferent = result->PixelsAntiAliased = result->PixelsIgnored = 0;
+    result->DiffRect = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    int max_diff = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tolerance_128 = _mm_set1_epi8((char)(unsigned char)tolerance);
+    __m128i max_diff_128 = zero;
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+    const uint8x16_t tolerance_128 = vdupq_n_u8((uint8_t)tolerance);
+    uint8x16_t max_diff_128 = vdupq_n_u8(0);
+#endif
+    for (int y = 0; y < s->Height; y++)
+    {
+        const unsigned int* row_a = s->Image + (size_t)y * s->Width;
+        const unsigned int* row_b = s->Golden + (size_t)y * s->Width;
+        int x = 0;
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+        for (; x + 4 <= s->Width; x += 4)
+        {
+            const __m128i a = _mm_loadu_si128((const __m128i*)(row_a + x));
+            const __m128i b = _mm_loadu_si128((const __m128i*)(row_b + x));
+            const __m128i d = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            max_diff_128 = _mm_max_epu8(max_diff_128, d);
+            const int within_mask = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_subs_epu8(d, tolerance_128), zero));
+            if (within_mask == 0xFFFF)
+                continue;
+            for (int k = 0; k < 4; k++)
+                if ((within_mask & (1 << (k * 4))) == 0)
+                    ImGuiCaptureCompare_ClassifyPixel(s, x + k, y);
+        }
+#elif defined(IMGUI_CAPTURE_ENABLE_NEON)
+        for (; x + 4 <= s->Width; x += 4)
+        {
+            const uint8x16_t d = vabdq_u8(vld1q_u8((const uint8_t*)(row_a + x)), vld1q_u8((const uint8_t*)(row_b + x)));
+            max_diff_128 = vmaxq_u8(max_diff_128, d);
+            const uint32x4_t over = vreinterpretq_u32_u8(vqsubq_u8(d, tolerance_128));
+            const uint64x2_t over_64 = vreinterpretq_u64_u32(over);
+            if ((vgetq_lane_u64(over_64, 0) | vgetq_lane_u64(over_64, 1)) == 0)
+                continue;
+            uint32_t over_lanes[4];
+            vst1q_u32(over_lanes, over);
+            for (int k = 0; k < 4; k++)
+                if (over_lanes[k] != 0)
+                    ImGuiCaptureCompare_ClassifyPixel(s, x + k, y);
+        }
+#endif
+        for (; x < s->Width; x++)
+        {
+            const int d = ImGuiCaptureCompare_PixelDiff(row_a[x], row_b[x]);
+            max_diff = ImMax(max_diff, d);
+            if (d > tolerance)
+                ImGuiCaptureCompare_ClassifyPixel(s, x, y);
+        }
+    }
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2) || defined(IMGUI_CAPTURE_ENABLE_NEON)
+    unsigned char max_diff_lanes[16];
+#if defined(IMGUI_CAPTURE_ENABLE_SSE2)
+    _mm_storeu_si128((__m128i*)max_diff_lanes, max_diff_128);
+#else
+    vst1q_u8(max_diff_lanes, max_diff_128);
+#endif
+    for (unsigned char lane : max_diff_lanes)
+        max_diff = ImMax(max_diff, (int)lane);
+#endif
+    result->MaxChannelDiff = max_diff;
+    if (result->PixelsDifferent == 0)
+        result->DiffRect = ImRect();
+}
+
+// Compare pixels, fill 'result' and write diff image to args->InDiffFile on failure ('diff_data' is a buffer of same size, or NULL).
+static void ImGuiCaptureImageBuf_CompareJob(const unsigned int* image, int w, int h, const ImGuiCaptureImageBuf* golden, const ImGuiCaptureCompareArgs* args, unsigned int* diff_data, const ImGuiCapturePngSettings* png_settings, ImGuiCaptureCompareResult* result)
+{
+    const ImU64 time_start = ImTimeGetInMicroseconds();
+    result->GoldenSize = ImVec2((float)golden->Width, (float)golden->Height);
+    result->SizeMismatch = (golden->Width != w || golden->Height != h);
+    if (!result->SizeMismatch)
+    {
+        ImGuiCaptureCompareState state = { image, golden->Data, w, h, args, NULL, result };
+        ImGuiCaptureCompare_Run(&state);
+        result->Success = (result->PixelsDifferent <= args->InMaxDifferentPixels);
+        if (!result->Success && diff_data != NULL && args->InDiffFile[0] != 0)
+        {
+            for (size_t n = 0; n < (size_t)w * (size_t)h; n++)
+            {
+                const unsigned int p = golden->Data[n];
+                const unsigned int luma = (((p >> 0) & 0xFF) * 77 + ((p >> 8) & 0xFF) * 150 + ((p >> 16) & 0xFF) * 29) >> 8;
+                const unsigned int v = 128 + luma / 2;
+                diff_data[n] = ImGuiCaptureCompare_MakeRGBA(v, v, v);
+            }
+            state.Paint = diff_data;
+            ImGuiCaptureCompare_Run(&state);
+            if (ImGuiCaptureImageBuf_WriteFile(args->InDiffFile, w, h, diff_data, png_settings))
+                ImStrncpy(result->DiffFile, args->InDiffFile, IM_ARRAYSIZE(result->DiffFile));
+        }
+    }
+    result->DurationMs = (float)((double)(ImTimeGetInMicroseconds() - time_start) / 1000.0);
+}
+
+#endif // #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiCaptureImageWriter
+//-----------------------------------------------------------------------------
+// Encoding large PNG files takes tens of milliseconds. When ImGuiCaptureContext::ImageWriterThreads > 0,
+// captured pixels are handed over to worker threads through a fixed amount of job slots:
+// - Main thread fills a Free slot (blocking while none is available) and marks it Queued.
+// - Worker threads pick the oldest Queued slot, encode and write it, then mark it Done.
+// - Main thread reclaims Done slots: frees pixels and stores results for PollImageWriterResult().
+// Golden image comparisons (ImGuiCaptureArgs::InCompare) go through the same slots and threads.
+// Pixels are allocated and freed on main thread only: worker threads never call IM_ALLOC()/IM_FREE().
+//-----------------------------------------------------------------------------
+
+struct ImGuiCaptureGoldenImage
+{
+    char                                Filename[256] = "";
+    ImGuiCaptureImageBuf                Image;              // Empty when file couldn't be loaded
+};
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+enum ImGuiCaptureImageWriterSlotState
+{
+    ImGuiCaptureImageWriterSlotState_Free,
+    ImGuiCaptureImageWriterSlotState_Queued,
+    ImGuiCaptureImageWriterSlotState_Processing,
+    ImGuiCaptureImageWriterSlotState_Done
+};
+
+enum ImGuiCaptureImageWriterJob
+{
+    ImGuiCaptureImageWriterJob_Write,
+    ImGuiCaptureImageWriterJob_Compare
+};
+
+struct ImGuiCaptureImageWriterSlot
+{
+    ImGuiCaptureImageWriterSlotState    State = ImGuiCaptureImageWriterSlotState_Free;
+    ImGuiCaptureImageWriterJob          Job = ImGuiCaptureImageWriterJob_Write;
+    int                                 Sequence = 0;       // Queue order
+    int                                 Width = 0;
+    int                                 Height = 0;
+    unsigned int*                       Data = NULL;        // Owned pixels (RGBA8)
+    ImGuiCapturePngSettings             PngSettings;        // Copied from ImGuiCaptureContext when queued (also used by diff images)
+    ImGuiCaptureImageWriterResult       Result;             // Write job
+
+    // Compare job
+    const ImGuiCaptureImageBuf*         Golden = NULL;      // Cached golden image (read only, outlives job)
+    unsigned int*                       DiffData = NULL;    // Owned diff image pixels, or NULL
+    ImGuiCaptureCompareArgs             CompareArgs;        // Copy of arguments, with ignore rectangles in image coordinates. Freed in _DestroyImageWriterThreads().
+    ImGuiCaptureCompareResult           CompareResult;
+};
+
+struct ImGuiCaptureImageWriter
+{
+    std::mutex                          Mutex;
+    std::condition_variable             QueuedCond;         // Signaled when a slot is queued, or on shutdown
+    std::condition_variable             DoneCond;           // Signaled when a slot is done
+    ImVector<std::thread*>              Threads;
+    ImVector<ImGuiCaptureImageWriterSlot> Slots;            // Fixed size, never reallocated while threads are running
+    int                                 SequenceNext = 0;
+    bool                                ShouldExit = false;
+};
+
+static void ImGuiCaptureImageWriter_ThreadMain(ImGuiCaptureImageWriter* writer, int thread_n)
+{
+    char thread_name[32];
+    ImFormatString(thread_name, IM_ARRAYSIZE(thread_name), "Capture Writer %d", thread_n);
+    ImThreadSetCurrentThreadDescription(thread_name);
+
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    while (true)
+    {
+        // Pick oldest queued slot
+        ImGuiCaptureImageWriterSlot* slot = NULL;
+        for (ImGuiCaptureImageWriterSlot& slot_candidate : writer->Slots)
+            if (slot_candidate.State == ImGuiCaptureImageWriterSlotState_Queued && (slot == NULL || slot_candidate.Sequence < slot->Sequence))
+                slot = &slot_candidate;
+        if (slot == NULL)
+        {
+            if (writer->ShouldExit)
+                break;
+            writer->QueuedCond.wait(lock);
+            continue;
+        }
+        slot->State = ImGuiCaptureImageWriterSlotState_Processing;
+
+        // Encode and write (or compare) without holding the lock
+        lock.unlock();
+        if (slot->Job == ImGuiCaptureImageWriterJob_Compare)
+        {
+            ImGuiCaptureImageBuf_CompareJob(slot->Data, slot->Width, slot->Height, slot->Golden, &slot->CompareArgs, slot->DiffData, &slot->PngSettings, &slot->CompareResult);
+        }
+        else
+        {
+            const ImU64 time_start = ImTimeGetInMicroseconds();
+            slot->Result.Success = ImGuiCaptureImageBuf_WriteFile(slot->Result.Filename, slot->Width, slot->Height, slot->Data, &slot->PngSettings);
+            slot->Result.DurationMs = (float)((double)(ImTimeGetInMicroseconds() - time_start) / 1000.0);
+        }
+        lock.lock();
+
+        slot->State = ImGuiCaptureImageWriterSlotState_Done;
+        writer->DoneCond.notify_all();
+    }
+}
+
+// Main thread only. Mutex must be held.
+static void ImGuiCaptureImageWriter_ReclaimDoneSlots(ImGuiCaptureImageWriter* writer, ImGuiCaptureContext* ctx)
+{
+    for (ImGuiCaptureImageWriterSlot& slot : writer->Slots)
+        if (slot.State == ImGuiCaptureImageWriterSlotState_Done)
+        {
+            if (slot.Job == ImGuiCaptureImageWriterJob_Compare)
+                ctx->_CompareResults.push_back(slot.CompareResult);
+            else
+                ctx->_ImageWriterResults.push_back(slot.Result);
+            IM_FREE(slot.Data);
+            if (slot.DiffData)
+                IM_FREE(slot.DiffData);
+            slot.Data = slot.DiffData = NULL;
+            slot.State = ImGuiCaptureImageWriterSlotState_Free;
+        }
+}
+
+// Main thread only. Mutex must be held. Wait for a free slot if the queue is full.
+static ImGuiCaptureImageWriterSlot* ImGuiCaptureImageWriter_AcquireSlot(ImGuiCaptureImageWriter* writer, ImGuiCaptureContext* ctx, std::unique_lock<std::mutex>& lock)
+{
+    while (true)
+    {
+        ImGuiCaptureImageWriter_ReclaimDoneSlots(writer, ctx);
+        for (ImGuiCaptureImageWriterSlot& slot : writer->Slots)
+            if (slot.State == ImGuiCaptureImageWriterSlotState_Free)
+                return &slot;
+        writer->DoneCond.wait(lock);
+    }
+}
+
+static bool ImGuiCaptureImageWriter_IsIdle(ImGuiCaptureImageWriter* writer)
+{
+    for (ImGuiCaptureImageWriterSlot& slot : writer->Slots)
+        if (slot.State == ImGuiCaptureImageWriterSlotState_Queued || slot.State == ImGuiCaptureImageWriterSlotState_Processing)
+            return false;
+    return true;
+}
 
 //-----------------------------------------------------------------------------
-// [SECTION] Link stb_image_write.h
+// Video frames are fed to the video encoder pipe by a dedicated writer thread, so a slow encoder doesn't stall
+// the frame loop. Frame buffers are swapped (not copied) with the capture buffer. When all frame buffers are
+// queued, ImGuiCaptureContext::VideoBackpressure decides whether to wait, drop the frame or add a buffer.
+// After EndVideoCapture(), the writer thread writes remaining frames then closes the pipe, which waits for the
+// encoder to exit, while main thread carries on.
 //-----------------------------------------------------------------------------
 
+struct ImGuiCaptureVideoFrame
+{
+    ImGuiCaptureImageWriterSlotState    State = ImGuiCaptureImageWriterSlotState_Free;
+    int                                 Sequence = 0;       // Queue order
+    int                                 WriteCount = 0;     // Number of times to write frame (> 1 when repeating duplicate frames)
+    unsigned int*                       Data = NULL;        // Owned pixels (RGBA8)
+};
+
+struct ImGuiCaptureVideoWriter
+{
+    std::mutex                          Mutex;
+    std::condition_variable             QueuedCond;         // Signaled when a frame is queued, or when finalizing
+    std::condition_variable             FreeCond;           // Signaled when a frame is written, or when done
+    std::thread*                        Thread = NULL;
+    FILE*                               Pipe = NULL;
+    bool                                PipeIsProcess = true; // Pipe is stdin of video encoder process (ImOsPOpen()), otherwise a regular file
+    size_t                              FrameSize = 0;      // In bytes
+    ImVector<ImGuiCaptureVideoFrame*>   Frames;             // Frame buffers. Stored by pointer so they stay valid when growing.
+    ImGuiCaptureVideoFrame*             LastFrame = NULL;   // Most recently queued frame. Kept unchanged to compare next frame with.
+    int                                 SequenceNext = 0;
+    bool                                Finalize = false;   // Set by main thread: write remaining frames then close pipe
+    bool                                Paused = false;     // Set by main thread: don't write frames until cleared (tests use it to simulate a slow video encoder)
+    bool                                Done = false;       // Set by writer thread once pipe is closed
+    bool                                WriteError = false;
+    ImU64                               FinalizeStartTime = 0;
+    ImGuiCaptureImageWriterResult       Result;
+};
+
+static void ImGuiCaptureVideoWriter_ThreadMain(ImGuiCaptureVideoWriter* writer)
+{
+    ImThreadSetCurrentThreadDescription("Capture Video Writer");
+
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    while (true)
+    {
+        ImGuiCaptureVideoFrame* frame = NULL;
+        for (ImGuiCaptureVideoFrame* frame_candidate : writer->Frames)
+            if (frame_candidate->State == ImGuiCaptureImageWriterSlotState_Queued && (frame == NULL || frame_candidate->Sequence < frame->Sequence))
+                frame = frame_candidate;
+        if (frame == NULL || writer->Paused)
+        {
+            if (frame == NULL && writer->Finalize)
+                break;
+            writer->QueuedCond.wait(lock);
+            continue;
+        }
+        frame->State = ImGuiCaptureImageWriterSlotState_Processing;
+        const int write_count = frame->WriteCount;
+        frame->WriteCount = 0;
+
+        lock.unlock();
+        bool success = true;
+        for (int n = 0; n < write_count && success; n++)
+            success = fwrite(frame->Data, 1, writer->FrameSize, writer->Pipe) == writer->FrameSize;
+        lock.lock();
+
+        // Frame may have been repeated again while we were writing it
+        writer->WriteError |= !success;
+        frame->State = (frame->WriteCount > 0) ? ImGuiCaptureImageWriterSlotState_Queued : ImGuiCaptureImageWriterSlotState_Free;
+        writer->FreeCond.notify_all();
+    }
+
+    // Closing the pipe waits for video encoder to finish
+    lock.unlock();
+    if (writer->PipeIsProcess)
+        ImOsPClose(writer->Pipe);
+    else
+        writer->WriteError |= (fclose(writer->Pipe) != 0);
+    const ImU64 time_end = ImTimeGetInMicroseconds();
+    lock.lock();
+
+    writer->Pipe = NULL;
+    writer->Result.Success = !writer->WriteError;
+    writer->Result.DurationMs = (float)((double)(time_end - writer->FinalizeStartTime) / 1000.0);
+    writer->Done = true;
+    writer->FreeCond.notify_all();
+}
+
+static ImGuiCaptureVideoWriter* ImGuiCaptureVideoWriter_Create(FILE* pipe, bool pipe_is_process, int width, int height, int frames_count, const ImGuiCaptureArgs* args)
+{
+    ImGuiCaptureVideoWriter* writer = IM_NEW(ImGuiCaptureVideoWriter)();
+    writer->Pipe = pipe;
+    writer->PipeIsProcess = pipe_is_process;
+    writer->FrameSize = (size_t)width * (size_t)height * 4;
+    for (int n = 0; n < ImMax(frames_count, 2); n++)
+    {
+        ImGuiCaptureVideoFrame* frame = IM_NEW(ImGuiCaptureVideoFrame)();
+        frame->Data = (unsigned int*)IM_ALLOC(writer->FrameSize);
+        writer->Frames.push_back(frame);
+    }
+    ImStrncpy(writer->Result.Filename, args->InOutputFile, IM_ARRAYSIZE(writer->Result.Filename));
+    writer->Result.UserData = args->InUserData;
+    writer->Thread = new std::thread(ImGuiCaptureVideoWriter_ThreadMain, writer);
+    return writer;
+}
+
+// Compute bounding rectangle of pixels which differ between two images of same size.
+// Return false when images are identical. Rows are compared with memcmp(), which C libraries vectorize.
+static bool ImGuiCaptureImageBuf_ComputeDamageRect(const unsigned int* a, const unsigned int* b, int w, int h, ImRect* out_rect)
+{
+    const size_t row_size = (size_t)w * 4;
+    int y0 = 0;
+    while (y0 < h && memcmp(a + y0 * w, b + y0 * w, row_size) == 0)
+        y0++;
+    if (y0 == h)
+    {
+        *out_rect = ImRect();
+        return false;
+    }
+    int y1 = h - 1;
+    while (y1 > y0 && memcmp(a + y1 * w, b + y1 * w, row_size) == 0)
+        y1--;
+
+    // Narrow columns: only scan the part of each row outside of current [x0,x1] range
+    int x0 = w, x1 = -1;
+    for (int y = y0; y <= y1; y++)
+    {
+        const unsigned int* row_a = a + y * w;
+        const unsigned int* row_b = b + y * w;
+        for (int x = 0; x < x0; x++)
+            if (row_a[x] != row_b[x])
+            {
+                x0 = x;
+                break;
+            }
+        for (int x = w - 1; x > x1; x--)
+            if (row_a[x] != row_b[x])
+            {
+                x1 = x;
+                break;
+            }
+    }
+    *out_rect = ImRect((float)x0, (float)y0, (float)(x1 + 1), (float)(y1 + 1));
+    return true;
+}
+
+// Hand over captured frame. Pixels are swapped with a free frame buffer, which 'image' can capture next frame into.
+// Frames identical to previous one are repeated or skipped according to 'duplicate_frames'.
+// A damage rectangle is recorded for each queued frame, relative to previous queued frame (dropped or skipped frames have none).
+static void ImGuiCaptureVideoWriter_QueueFrame(ImGuiCaptureVideoWriter* writer, ImGuiCaptureVideoBackpressure backpressure, ImGuiCaptureVideoDuplicateFrames duplicate_frames, ImGuiCaptureImageBuf* image, ImGuiCaptureArgs* args)
+{
+    IM_ASSERT((size_t)image->Width * (size_t)image->Height * 4 == writer->FrameSize);
+
+    // Track damage without holding the lock: LastFrame is only replaced by main thread (below), and writer thread only reads its pixels.
+    ImRect damage_rect(0.0f, 0.0f, (float)image->Width, (float)image->Height);
+    bool is_duplicate = false;
+    if (writer->LastFrame != NULL)
+        is_duplicate = !ImGuiCaptureImageBuf_ComputeDamageRect(writer->LastFrame->Data, image->Data, image->Width, image->Height, &damage_rect);
+    if (is_duplicate)
+    {
+        args->OutVideoFramesDuplicated++;
+        if (duplicate_frames == ImGuiCaptureVideoDuplicateFrames_Skip)
+            return;
+    }
+
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    if (is_duplicate)
+    {
+        if (duplicate_frames == ImGuiCaptureVideoDuplicateFrames_Repeat)
+        {
+            ImGuiCaptureVideoFrame* frame = writer->LastFrame;
+            frame->WriteCount++;
+            if (frame->State == ImGuiCaptureImageWriterSlotState_Free)
+            {
+                frame->State = ImGuiCaptureImageWriterSlotState_Queued;
+                frame->Sequence = writer->SequenceNext++;
+            }
+            args->OutVideoFramesQueued++;
+            args->OutVideoDamageRects.push_back(damage_rect);
+            lock.unlock();
+            writer->QueuedCond.notify_one();
+            return;
+        }
+    }
+
+    ImGuiCaptureVideoFrame* frame = NULL;
+    while (frame == NULL)
+    {
+        for (ImGuiCaptureVideoFrame* frame_candidate : writer->Frames)
+            if (frame_candidate->State == ImGuiCaptureImageWriterSlotState_Free && frame_candidate != writer->LastFrame)
+            {
+                frame = frame_candidate;
+                break;
+            }
+        if (frame != NULL)
+            break;
+        if (backpressure == ImGuiCaptureVideoBackpressure_Drop)
+        {
+            args->OutVideoFramesDropped++;
+            return;
+        }
+        if (backpressure == ImGuiCaptureVideoBackpressure_Grow)
+        {
+            frame = IM_NEW(ImGuiCaptureVideoFrame)();
+            frame->Data = (unsigned int*)IM_ALLOC(writer->FrameSize);
+            writer->Frames.push_back(frame);
+            break;
+        }
+        writer->FreeCond.wait(lock);
+    }
+    ImSwap(frame->Data, image->Data);
+    frame->State = ImGuiCaptureImageWriterSlotState_Queued;
+    frame->Sequence = writer->SequenceNext++;
+    frame->WriteCount = 1;
+    writer->LastFrame = frame;
+    args->OutVideoFramesQueued++;
+    args->OutVideoDamageRects.push_back(damage_rect);
+    lock.unlock();
+    writer->QueuedCond.notify_one();
+}
+
+// When 'failed' is set, remaining frames are still written (video is playable) but result is reported as failed.
+static void ImGuiCaptureVideoWriter_BeginFinalize(ImGuiCaptureVideoWriter* writer, bool failed)
+{
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        writer->Finalize = true;
+        writer->Paused = false;
+        writer->WriteError |= failed;
+        writer->FinalizeStartTime = ImTimeGetInMicroseconds();
+    }
+    writer->QueuedCond.notify_all();
+}
+
+// Main thread only. Destroy writers which are done, storing their result. When 'wait' is set, block until all are done.
+static void ImGuiCaptureVideoWriter_ReclaimFinalized(ImVector<ImGuiCaptureVideoWriter*>* writers, ImVector<ImGuiCaptureImageWriterResult>* out_results, bool wait)
+{
+    for (int writer_n = 0; writer_n < writers->Size; writer_n++)
+    {
+        ImGuiCaptureVideoWriter* writer = (*writers)[writer_n];
+        {
+            std::unique_lock<std::mutex> lock(writer->Mutex);
+            while (wait && !writer->Done)
+                writer->FreeCond.wait(lock);
+            if (!writer->Done)
+                continue;
+        }
+        writer->Thread->join();
+        delete writer->Thread;
+        for (ImGuiCaptureVideoFrame* frame : writer->Frames)
+        {
+            IM_FREE(frame->Data);
+            IM_DELETE(frame);
+        }
+        out_results->push_back(writer->Result);
+        IM_DELETE(writer);
+        writers->erase(writers->Data + writer_n);
+        writer_n--;
+    }
+}
+
+#endif // #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+
+void ImGuiCaptureContext::_QueueImageWrite(ImGuiCaptureImageBuf* image, const ImGuiCaptureArgs* args)
+{
 #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(image->Data != NULL);
+    ImFileCreateDirectoryChain(args->InOutputFile, ImPathFindFilename(args->InOutputFile));
+    ImGuiCapturePngSettings png_settings;
+    png_settings.CompressionLevel = PngCompressionLevel;
+    png_settings.Filter = PngFilter;
 
-// Compile time options:
-//#define IMGUI_STB_NAMESPACE            ImStb
-//#define IMGUI_STB_IMAGE_WRITE_FILENAME "my_folder/stb_image_write.h"
-//#define IMGUI_DISABLE_STB_IMAGE_WRITE_IMPLEMENTATION
+    ImGuiCaptureImageWriterResult result;
+    ImStrncpy(result.Filename, args->InOutputFile, IM_ARRAYSIZE(result.Filename));
+    result.UserData = args->InUserData;
 
-// stb_image_write
-#ifdef _MSC_VER
-#pragma warning (push)
-#pragma warning (disable: 4456)                             // declaration of 'xx' hides previous local declaration
-#pragma warning (disable: 4457)                             // declaration of 'xx' hides function parameter
+    // Synchronous write
+    if (ImageWriterThreads <= 0)
+    {
+        _DestroyImageWriterThreads();
+        const ImU64 time_start = ImTimeGetInMicroseconds();
+        result.Success = ImGuiCaptureImageBuf_WriteFile(result.Filename, image->Width, image->Height, image->Data, &png_settings);
+        result.DurationMs = (float)((double)(ImTimeGetInMicroseconds() - time_start) / 1000.0);
+        _ImageWriterResults.push_back(result);
+        image->Clear();
+        return;
+    }
+
+    // Find a free slot, waiting for one to be done if the queue is full
+    _CreateImageWriterThreads();
+    ImGuiCaptureImageWriter* writer = _ImageWriter;
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    ImGuiCaptureImageWriterSlot* slot = ImGuiCaptureImageWriter_AcquireSlot(writer, this, lock);
+
+    // Take ownership of pixels
+    slot->State = ImGuiCaptureImageWriterSlotState_Queued;
+    slot->Job = ImGuiCaptureImageWriterJob_Write;
+    slot->Sequence = writer->SequenceNext++;
+    slot->Width = image->Width;
+    slot->Height = image->Height;
+    slot->Data = image->Data;
+    slot->PngSettings = png_settings;
+    slot->Result = result;
+    image->Data = NULL;
+    lock.unlock();
+    writer->QueuedCond.notify_one();
 #else
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
+    IM_UNUSED(image);
+    IM_UNUSED(args);
 #endif
+}
 
-#ifdef IMGUI_STB_NAMESPACE
-namespace IMGUI_STB_NAMESPACE
+void ImGuiCaptureContext::_QueueImageCompare(ImGuiCaptureImageBuf* image, const ImGuiCaptureArgs* args)
 {
-#endif
-#ifndef STB_IMAGE_WRITE_IMPLEMENTATION                       // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
-#ifndef IMGUI_DISABLE_STB_IMAGE_WRITE_IMPLEMENTATION         // in case the user already have an implementation in another compilation unit
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#endif
-#ifdef IMGUI_STB_IMAGE_WRITE_FILENAME
-#include IMGUI_STB_IMAGE_WRITE_FILENAME
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(image->Data != NULL);
+    const ImGuiCaptureCompareArgs* compare_args = &args->InCompare;
+    ImGuiCapturePngSettings png_settings;           // Diff image
+    png_settings.CompressionLevel = PngCompressionLevel;
+    png_settings.Filter = PngFilter;
+    ImGuiCaptureCompareResult result;
+    ImStrncpy(result.GoldenFile, compare_args->InGoldenFile, IM_ARRAYSIZE(result.GoldenFile));
+    result.ImageSize = ImVec2((float)image->Width, (float)image->Height);
+    result.UserData = args->InUserData;
+
+    const ImGuiCaptureImageBuf* golden = GetGoldenImage(compare_args->InGoldenFile);
+    if (golden == NULL)
+    {
+        result.GoldenMissing = true;
+        _CompareResults.push_back(result);
+        image->Clear();
+        return;
+    }
+    if (compare_args->InDiffFile[0] != 0)
+        ImFileCreateDirectoryChain(compare_args->InDiffFile, ImPathFindFilename(compare_args->InDiffFile));
+
+    // Synchronous compare
+    if (ImageWriterThreads <= 0)
+    {
+        _DestroyImageWriterThreads();
+        ImGuiCaptureCompareArgs job_args = *compare_args;
+        for (ImRect& ignore_rect : job_args.InIgnoreRects)
+            ignore_rect.Translate(-_CaptureImageOrigin);
+        ImGuiCaptureImageBuf diff;
+        if (compare_args->InDiffFile[0] != 0)
+            diff.CreateEmpty(image->Width, image->Height);
+        ImGuiCaptureImageBuf_CompareJob(image->Data, image->Width, image->Height, golden, &job_args, diff.Data, &png_settings, &result);
+        _CompareResults.push_back(result);
+        image->Clear();
+        return;
+    }
+
+    _CreateImageWriterThreads();
+    ImGuiCaptureImageWriter* writer = _ImageWriter;
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    ImGuiCaptureImageWriterSlot* slot = ImGuiCaptureImageWriter_AcquireSlot(writer, this, lock);
+
+    // Take ownership of pixels. Ignore rectangles are given in screen coordinates.
+    slot->State = ImGuiCaptureImageWriterSlotState_Queued;
+    slot->Job = ImGuiCaptureImageWriterJob_Compare;
+    slot->Sequence = writer->SequenceNext++;
+    slot->Width = image->Width;
+    slot->Height = image->Height;
+    slot->Data = image->Data;
+    slot->Golden = golden;
+    slot->PngSettings = png_settings;
+    slot->DiffData = (compare_args->InDiffFile[0] != 0) ? (unsigned int*)IM_ALLOC((size_t)image->Width * (size_t)image->Height * 4) : NULL;
+    slot->CompareArgs = *compare_args;
+    for (ImRect& ignore_rect : slot->CompareArgs.InIgnoreRects)
+        ignore_rect.Translate(-_CaptureImageOrigin);
+    slot->CompareResult = result;
+    image->Data = NULL;
+    lock.unlock();
+    writer->QueuedCond.notify_one();
 #else
-#include "thirdparty/stb/imstb_image_write.h"
-#endif  // #ifdef IMGUI_STB_IMAGE_WRITE_FILENAME
-#endif  // #ifndef STB_IMAGE_WRITE_IMPLEMENTATION
-#ifdef IMGUI_STB_NAMESPACE
-} // namespace ImStb
-using namespace IMGUI_STB_NAMESPACE;
+    IM_UNUSED(image);
+    IM_UNUSED(args);
 #endif
+}
 
-#ifdef _MSC_VER
-#pragma warning (pop)
-#else
-#pragma GCC diagnostic pop
+bool ImGuiCaptureContext::PollCompareResult(ImGuiCaptureCompareResult* out_result)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    if (_ImageWriter != NULL)
+    {
+        std::lock_guard<std::mutex> lock(_ImageWriter->Mutex);
+        ImGuiCaptureImageWriter_ReclaimDoneSlots(_ImageWriter, this);
+    }
 #endif
+    if (_CompareResults.empty())
+        return false;
+    *out_result = _CompareResults[0];
+    _CompareResults.erase(_CompareResults.Data);
+    return true;
+}
 
-#endif // #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+// Golden images are loaded once and kept until ClearGoldenImages().
+const ImGuiCaptureImageBuf* ImGuiCaptureContext::GetGoldenImage(const char* filename)
+{
+    for (ImGuiCaptureGoldenImage* golden : _GoldenImages)
+        if (strcmp(golden->Filename, filename) == 0)
+            return golden->Image.Data ? &golden->Image : NULL;
+    ImGuiCaptureGoldenImage* golden = IM_NEW(ImGuiCaptureGoldenImage)();
+    ImStrncpy(golden->Filename, filename, IM_ARRAYSIZE(golden->Filename));
+    golden->Image.LoadFile(filename);
+    _GoldenImages.push_back(golden);
+    return golden->Image.Data ? &golden->Image : NULL;
+}
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImGuiCaptureImageBuf
-// Helper class for simple bitmap manipulation (not particularly efficient!)
-//-----------------------------------------------------------------------------
+void ImGuiCaptureContext::ClearGoldenImages()
+{
+    FlushImageWriter(); // Pending comparisons read golden images, and callers rely on all queued writes being completed
+    for (ImGuiCaptureGoldenImage* golden : _GoldenImages)
+        IM_DELETE(golden);
+    _GoldenImages.clear();
+}
 
-void ImGuiCaptureImageBuf::Clear()
+bool ImGuiCaptureContext::PollImageWriterResult(ImGuiCaptureImageWriterResult* out_result)
 {
-    if (Data)
-        IM_FREE(Data);
-    Data = NULL;
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    if (_ImageWriter != NULL)
+    {
+        std::lock_guard<std::mutex> lock(_ImageWriter->Mutex);
+        ImGuiCaptureImageWriter_ReclaimDoneSlots(_ImageWriter, this);
+    }
+    ImGuiCaptureVideoWriter_ReclaimFinalized(&_VideoWritersFinalizing, &_ImageWriterResults, false);
+#endif
+    if (_ImageWriterResults.empty())
+        return false;
+    *out_result = _ImageWriterResults[0];
+    _ImageWriterResults.erase(_ImageWriterResults.Data);
+    return true;
 }
 
-void ImGuiCaptureImageBuf::CreateEmpty(int w, int h)
+void ImGuiCaptureContext::FlushImageWriter()
 {
-    Clear();
-    Width = w;
-    Height = h;
-    Data = (unsigned int*)IM_ALLOC((size_t)(Width * Height * 4));
-    memset(Data, 0, (size_t)(Width * Height * 4));
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    ImGuiCaptureVideoWriter_ReclaimFinalized(&_VideoWritersFinalizing, &_ImageWriterResults, true);
+    if (_ImageWriter == NULL)
+        return;
+    ImGuiCaptureImageWriter* writer = _ImageWriter;
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    while (!ImGuiCaptureImageWriter_IsIdle(writer))
+        writer->DoneCond.wait(lock);
+    ImGuiCaptureImageWriter_ReclaimDoneSlots(writer, this);
+#endif
 }
 
-bool ImGuiCaptureImageBuf::SaveFile(const char* filename)
+void ImGuiCaptureContext::ShutdownImageWriter()
 {
 #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
-    IM_ASSERT(Data != NULL);
-    ImFileCreateDirectoryChain(filename, ImPathFindFilename(filename));
-    int ret = stbi_write_png(filename, Width, Height, 4, Data, Width * 4);
-    return ret != 0;
-#else
-    IM_UNUSED(filename);
-    return false;
+    _FinalizeVideoWriter();
+    FlushImageWriter();
+    _DestroyImageWriterThreads();
 #endif
 }
 
-void ImGuiCaptureImageBuf::RemoveAlpha()
+void ImGuiCaptureContext::_CreateImageWriterThreads()
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    if (_ImageWriter != NULL && (_ImageWriter->Threads.Size != ImageWriterThreads || _ImageWriter->Slots.Size != ImMax(ImageWriterQueueSize, 1)))
+        _DestroyImageWriterThreads();
+    if (_ImageWriter == NULL)
+    {
+        _ImageWriter = IM_NEW(ImGuiCaptureImageWriter)();
+        _ImageWriter->Slots.resize(ImMax(ImageWriterQueueSize, 1), ImGuiCaptureImageWriterSlot());
+        for (int thread_n = 0; thread_n < ImageWriterThreads; thread_n++)
+            _ImageWriter->Threads.push_back(new std::thread(ImGuiCaptureImageWriter_ThreadMain, _ImageWriter, thread_n));
+    }
+#endif
+}
+
+void ImGuiCaptureContext::_DestroyImageWriterThreads()
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    if (_ImageWriter == NULL)
+        return;
+    ImGuiCaptureImageWriter* writer = _ImageWriter;
+    {
+        std::unique_lock<std::mutex> lock(writer->Mutex);
+        while (!ImGuiCaptureImageWriter_IsIdle(writer))
+            writer->DoneCond.wait(lock);
+        ImGuiCaptureImageWriter_ReclaimDoneSlots(writer, this);
+        writer->ShouldExit = true;
+    }
+    writer->QueuedCond.notify_all();
+    for (std::thread* thread : writer->Threads)
+    {
+        thread->join();
+        delete thread;
+    }
+    for (ImGuiCaptureImageWriterSlot& slot : writer->Slots)
+        slot.CompareArgs.InIgnoreRects.clear();     // ImVector<> doesn't destruct its elements
+    IM_DELETE(writer);
+    _ImageWriter = NULL;
+#endif
+}
+
+int ImGuiCaptureContext::ConvertImageFilesToPng(const char* const* filenames, int count)
 {
-    unsigned int* p = Data;
-    int n = Width * Height;
-    while (n-- > 0)
+    int converted_count = 0;
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    ImGuiCaptureArgs args;
+    ImGuiCaptureImageBuf image;
+    for (int n = 0; n < count; n++)
     {
-        *p |= IM_COL32_A_MASK;
-        p++;
+        const char* src_filename = filenames[n];
+        const char* ext = ImPathFindExtension(src_filename);
+        if (ImStricmp(ext, ".png") == 0)
+            continue;
+        if (!image.LoadFile(src_filename))
+        {
+            ImGuiCaptureImageWriterResult result;
+            ImStrncpy(result.Filename, src_filename, IM_ARRAYSIZE(result.Filename));
+            _ImageWriterResults.push_back(result);
+            continue;
+        }
+        ImFormatString(args.InOutputFile, IM_ARRAYSIZE(args.InOutputFile), "%.*s.png", (int)(ext - src_filename), src_filename);
+        _QueueImageWrite(&image, &args);
+        converted_count++;
     }
+    FlushImageWriter();
+#else
+    IM_UNUSED(filenames);
+    IM_UNUSED(count);
+#endif
+    return converted_count;
 }
 
 //-----------------------------------------------------------------------------
@@ -343,6 +2138,14 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
             full_size.y = ImMax(window->SizeFull.y, window->ContentSize.y + (window->WindowPadding.y + window->WindowBorderSize) * 2 + window->TitleBarHeight() + window->MenuBarHeight());
             ImGui::SetWindowSize(window, full_size);
             _HoveredWindow = g.HoveredWindow;
+
+            // Enlarge display to fit whole window once moved to top-left corner. Takes effect on next NewFrame(), unless backend overrides it.
+            if (args->InFlags & ImGuiCaptureFlags_EnlargeDisplay)
+            {
+                _BackupDisplaySize = io.DisplaySize;
+                io.DisplaySize = ImMax(io.DisplaySize, full_size + ImVec2(args->InPadding, args->InPadding) * 2.0f);
+                _DisplayEnlarged = true;
+            }
         }
         else
         {
@@ -389,6 +2192,13 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
                 _CaptureRect = viewport_rect;
             }
         }
+        // Display was enlarged but backend didn't follow (e.g. it sets io.DisplaySize from OS window size): restore and fallback to scrolling.
+        if (_DisplayEnlarged && GetMainViewportRect().GetSize().y < _CaptureRect.GetHeight())
+        {
+            io.DisplaySize = _BackupDisplaySize;
+            _DisplayEnlarged = false;
+        }
+
         if ((args->InFlags & ImGuiCaptureFlags_StitchAll) == 0)
         {
             // Can not capture area outside of screen. Clip capture rect, since we are capturing only visible rect anyway.
@@ -420,6 +2230,7 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
         IM_ASSERT(!_CaptureRect.IsInverted());
         args->OutImageSize = _CaptureRect.GetSize();
         output->CreateEmpty((int)_CaptureRect.GetWidth(), (int)_CaptureRect.GetHeight());
+        _CaptureImageOrigin = _CaptureRect.Min;
     }
 
     //-----------------------------------------------------------------
@@ -437,6 +2248,18 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
         const int y1 = (int)(capture_rect.Min.y - clip_rect.Min.y);
         const int w = (int)capture_rect.GetWidth();
         const int h = (int)ImMin(output->Height - _ChunkNo * capture_height, capture_height);
+
+        // Video frames must all have same size: end video when capture rectangle got clipped differently (e.g. display was resized).
+        if ((is_recording_video || _VideoWriter != NULL) && (w != output->Width || h != output->Height))
+        {
+            fprintf(stderr, "Capture size changed from %dx%d to %dx%d, video capturing failed.\n", output->Width, output->Height, w, h);
+            _VideoRecording = false;
+            _FinalizeVideoWriter(true);
+            output->Clear();
+            _EndCapture();
+            return ImGuiCaptureStatus_Error;
+        }
+
         if (h > 0)
         {
             IM_ASSERT(w == output->Width);
@@ -449,10 +2272,13 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
             if (!ScreenCaptureFunc(viewport_id, x1, y1, w, h, &output->Data[_ChunkNo * w * capture_height], ScreenCaptureUserData))
             {
                 fprintf(stderr, "Screen capture function failed.\n");
+                if (_DisplayEnlarged)
+                    io.DisplaySize = _BackupDisplaySize;
+                _DisplayEnlarged = false;
                 return ImGuiCaptureStatus_Error;
             }
 
-            if (args->InFlags & ImGuiCaptureFlags_StitchAll)
+            if ((args->InFlags & ImGuiCaptureFlags_StitchAll) && !_DisplayEnlarged)
             {
                 // Window moves up in order to expose it's lower part.
                 for (ImGuiWindow* window : args->InCaptureWindows)
@@ -463,8 +2289,8 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
 
             if (is_recording_video && (args->InFlags & ImGuiCaptureFlags_NoSave) == 0)
             {
-                // _VideoEncoderPipe is NULL when recording just started. Initialize recording state.
-                if (_VideoEncoderPipe == NULL)
+                // _VideoWriter is NULL when recording just started. Initialize recording state.
+                if (_VideoWriter == NULL)
                 {
                     // First video frame, initialize now that dimensions are known.
                     const unsigned int width = (unsigned int)capture_rect.GetWidth();
@@ -495,54 +2321,54 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
                     ImStrReplace(&cmd, "$HEIGHT", Str16f("%d", height).c_str());
                     ImStrReplace(&cmd, "$OUTPUT", args->InOutputFile);
                     fprintf(stdout, "# %s\n", cmd.c_str());
-                    _VideoEncoderPipe = ImOsPOpen(cmd.c_str(), "w");
-                    IM_ASSERT(_VideoEncoderPipe != NULL);
+                    FILE* encoder_pipe = ImOsPOpen(cmd.c_str(), "w");
+                    IM_ASSERT(encoder_pipe != NULL);
+                    _CreateVideoWriter(encoder_pipe, true, output->Width, output->Height, args);
                 }
 
-                // Save new video frame
-                fwrite(output->Data, 1, output->Width * output->Height * 4, _VideoEncoderPipe);
+                // Hand over new video frame to writer thread
+                _QueueVideoFrame(output, args);
             }
             if (is_recording_video)
                 _VideoLastFrameTime = current_time_sec;
         }
 
-        // Image is finalized immediately when we are not stitching. Otherwise, image is finalized when we have captured and stitched all frames.
-        if (!_VideoRecording && (!(args->InFlags & ImGuiCaptureFlags_StitchAll) || h <= 0))
+        // Image is finalized immediately when we are not stitching (or captured whole window at once in enlarged display). Otherwise, image is finalized when we have captured and stitched all frames.
+        if (!_VideoRecording && (!(args->InFlags & ImGuiCaptureFlags_StitchAll) || _DisplayEnlarged || h <= 0))
         {
             output->RemoveAlpha();
 
-            if (_VideoEncoderPipe != NULL)
+            if (_VideoWriter != NULL)
             {
-                // At this point _Recording is false, but we know we were recording because _VideoEncoderPipe is not NULL. Finalize video here.
-                ImOsPClose(_VideoEncoderPipe);
-                _VideoEncoderPipe = NULL;
+                // At this point _Recording is false, but we know we were recording because _VideoWriter is not NULL.
+                // Finalize video in background: writer thread writes remaining frames and waits for encoder to exit.
+                _FinalizeVideoWriter();
             }
             else if (args->InOutputImageBuf == NULL)
             {
-                // Save single frame.
-                if ((args->InFlags & ImGuiCaptureFlags_NoSave) == 0)
-                    output->SaveFile(args->InOutputFile);
-                output->Clear();
-            }
+                // Compare with golden image (possibly in background, in which case pixels ownership is transferred).
+                const bool save = (args->InFlags & ImGuiCaptureFlags_NoSave) == 0;
+                if (args->InCompare.InGoldenFile[0] != 0)
+                {
+                    if (save)
+                    {
+                        ImGuiCaptureImageBuf image_copy;
+                        image_copy.CreateFromCrop(output, 0, 0, output->Width, output->Height);
+                        _QueueImageCompare(&image_copy, args);
+                    }
+                    else
+                    {
+                        _QueueImageCompare(output, args);
+                    }
+                }
 
-            // Restore window positions unconditionally. We may have moved them ourselves during capture.
-            for (int i = 0; i < _BackupWindows.Size; i++)
-            {
-                ImGuiWindow* window = _BackupWindows[i];
-                if (window->Hidden)
-                    continue;
-                ImGui::SetWindowPos(window, _BackupWindowsRect[i].Min, ImGuiCond_Always);
-                ImGui::SetWindowSize(window, _BackupWindowsRect[i].GetSize(), ImGuiCond_Always);
+                // Save single frame (possibly in background, in which case pixels ownership is transferred).
+                if (save)
+                    _QueueImageWrite(output, args);
+                output->Clear();
             }
-            g.Style.DisplayWindowPadding = _BackupDisplayWindowPadding;
-            g.Style.DisplaySafeAreaPadding = _BackupDisplaySafeAreaPadding;
-
-            _FrameNo = _ChunkNo = 0;
-            _VideoLastFrameTime = 0;
-            _MouseRelativeToWindowPos = ImVec2(-FLT_MAX, -FLT_MAX);
-            _HoveredWindow = NULL;
-            _CaptureArgs = NULL;
 
+            _EndCapture();
             return ImGuiCaptureStatus_Done;
         }
     }
@@ -556,14 +2382,41 @@ ImGuiCaptureStatus ImGuiCaptureContext::CaptureUpdate(ImGuiCaptureArgs* args)
 #endif
 }
 
+// Restore window positions unconditionally. We may have moved them ourselves during capture.
+void ImGuiCaptureContext::_EndCapture()
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = 0; i < _BackupWindows.Size; i++)
+    {
+        ImGuiWindow* window = _BackupWindows[i];
+        if (window->Hidden)
+            continue;
+        ImGui::SetWindowPos(window, _BackupWindowsRect[i].Min, ImGuiCond_Always);
+        ImGui::SetWindowSize(window, _BackupWindowsRect[i].GetSize(), ImGuiCond_Always);
+    }
+    g.Style.DisplayWindowPadding = _BackupDisplayWindowPadding;
+    g.Style.DisplaySafeAreaPadding = _BackupDisplaySafeAreaPadding;
+    if (_DisplayEnlarged)
+        g.IO.DisplaySize = _BackupDisplaySize;
+    _DisplayEnlarged = false;
+
+    _FrameNo = _ChunkNo = 0;
+    _VideoLastFrameTime = 0;
+    _MouseRelativeToWindowPos = ImVec2(-FLT_MAX, -FLT_MAX);
+    _HoveredWindow = NULL;
+    _CaptureArgs = NULL;
+}
+
 void ImGuiCaptureContext::BeginVideoCapture(ImGuiCaptureArgs* args)
 {
     IM_ASSERT(args != NULL);
     IM_ASSERT(_VideoRecording == false);
-    IM_ASSERT(_VideoEncoderPipe == NULL);
+    IM_ASSERT(_VideoWriter == NULL);
     IM_ASSERT(args->InRecordFPSTarget >= 1 && args->InRecordFPSTarget <= 100);
 
     ImFileCreateDirectoryChain(args->InOutputFile, ImPathFindFilename(args->InOutputFile));
+    args->OutVideoFramesQueued = args->OutVideoFramesDropped = args->OutVideoFramesDuplicated = 0;
+    args->OutVideoDamageRects.resize(0);
     _VideoRecording = true;
     _CaptureArgs = args;
 }
@@ -581,6 +2434,58 @@ bool ImGuiCaptureContext::IsCapturingVideo()
     return _VideoRecording;
 }
 
+void ImGuiCaptureContext::_CreateVideoWriter(FILE* output, bool output_is_process, int width, int height, const ImGuiCaptureArgs* args)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(_VideoWriter == NULL && output != NULL);
+    _VideoWriter = ImGuiCaptureVideoWriter_Create(output, output_is_process, width, height, VideoFramesQueueSize, args);
+#else
+    IM_UNUSED(output);
+    IM_UNUSED(output_is_process);
+    IM_UNUSED(width);
+    IM_UNUSED(height);
+    IM_UNUSED(args);
+#endif
+}
+
+void ImGuiCaptureContext::_QueueVideoFrame(ImGuiCaptureImageBuf* image, ImGuiCaptureArgs* args)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(_VideoWriter != NULL);
+    ImGuiCaptureVideoWriter_QueueFrame(_VideoWriter, VideoBackpressure, VideoDuplicateFrames, image, args);
+#else
+    IM_UNUSED(image);
+    IM_UNUSED(args);
+#endif
+}
+
+void ImGuiCaptureContext::_PauseVideoWriter(bool paused)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    IM_ASSERT(_VideoWriter != NULL);
+    {
+        std::lock_guard<std::mutex> lock(_VideoWriter->Mutex);
+        _VideoWriter->Paused = paused;
+    }
+    _VideoWriter->QueuedCond.notify_all();
+#else
+    IM_UNUSED(paused);
+#endif
+}
+
+void ImGuiCaptureContext::_FinalizeVideoWriter(bool failed)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    if (_VideoWriter == NULL)
+        return;
+    ImGuiCaptureVideoWriter_BeginFinalize(_VideoWriter, failed);
+    _VideoWritersFinalizing.push_back(_VideoWriter);
+    _VideoWriter = NULL;
+#else
+    IM_UNUSED(failed);
+#endif
+}
+
 bool ImGuiCaptureContext::IsCapturing()
 {
     return _CaptureArgs != NULL;
@@ -914,6 +2819,13 @@ void ImGuiCaptureToolUI::ShowCaptureToolWindow(ImGuiCaptureContext* context, boo
         ImGui::EndDisabled();
         if (!content_stitching_available && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
             ImGui::SetTooltip("Content stitching is not possible when using viewports.");
+        ImGui::BeginDisabled(!content_stitching_available || !(_CaptureArgs.InFlags & ImGuiCaptureFlags_StitchAll));
+        ImGui::Indent();
+        ImGui::CheckboxFlags("Enlarge display", &_CaptureArgs.InFlags, ImGuiCaptureFlags_EnlargeDisplay);
+        ImGui::Unindent();
+        ImGui::EndDisabled();
+        if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+            ImGui::SetTooltip("Capture whole window at once by temporarily enlarging display.\nOnly works with renderers following io.DisplaySize (e.g. Null/Software app backends), otherwise fallback to scrolling.");
 
         ImGui::CheckboxFlags("Include other windows", &_CaptureArgs.InFlags, ImGuiCaptureFlags_IncludeOtherWindows);
         ImGui::CheckboxFlags("Include tooltips & popups", &_CaptureArgs.InFlags, ImGuiCaptureFlags_IncludeTooltipsAndPopups);
@@ -12,11 +12,19 @@
 
 // Our types
 struct ImGuiCaptureArgs;                // Parameters for Capture
+struct ImGuiCaptureCompareArgs;         // Parameters for comparing a capture with a golden image
+struct ImGuiCaptureCompareResult;       // Outcome of comparing a capture with a golden image
 struct ImGuiCaptureContext;             // State of an active capture tool
+struct ImGuiCaptureGoldenImage;         // Golden image loaded in cache
 struct ImGuiCaptureImageBuf;            // Simple helper to store an RGBA image in memory
+struct ImGuiCaptureImageWriter;         // Background workers encoding and writing image files
+struct ImGuiCaptureImageWriterResult;   // Outcome of writing one image file
+struct ImGuiCaptureVideoWriter;         // Background thread feeding frames to video encoder
 struct ImGuiCaptureToolUI;              // Capture tool instance + UI window
 
 typedef unsigned int ImGuiCaptureFlags; // See enum: ImGuiCaptureFlags_
+typedef int ImGuiCaptureVideoBackpressure; // See enum: ImGuiCaptureVideoBackpressure_
+typedef int ImGuiCaptureVideoDuplicateFrames; // See enum: ImGuiCaptureVideoDuplicateFrames_
 
 // Capture function which needs to be provided by user application
 typedef bool (ImGuiScreenCaptureFunc)(ImGuiID viewport_id, int x, int y, int w, int h, unsigned int* pixels, void* user_data);
@@ -27,7 +35,16 @@ struct ImGuiWindow; // imgui.h
 //-----------------------------------------------------------------------------
 
 // [Internal]
-// Helper class for simple bitmap manipulation (not particularly efficient!)
+// Pixel operations on RGBA8 buffers, vectorized with SSE2/AVX2/NEON when available. Strides are in pixels.
+IMGUI_API void ImGuiCaptureImageOps_FillAlpha(unsigned int* pixels, size_t count, unsigned char alpha);
+IMGUI_API void ImGuiCaptureImageOps_SwizzleRB(unsigned int* dst, const unsigned int* src, size_t count);                 // RGBA <-> BGRA. May be done in place.
+IMGUI_API void ImGuiCaptureImageOps_Premultiply(unsigned int* dst, const unsigned int* src, size_t count);               // Multiply RGB by alpha. May be done in place.
+IMGUI_API void ImGuiCaptureImageOps_FlipVertical(unsigned int* pixels, int w, int h, int stride);                       // In place, e.g. after OpenGL readback.
+IMGUI_API void ImGuiCaptureImageOps_Blit(unsigned int* dst, int dst_stride, const unsigned int* src, int src_stride, int w, int h);
+IMGUI_API void ImGuiCaptureImageOps_DownscaleBox(unsigned int* dst, int dst_stride, const unsigned int* src, int src_stride, int src_w, int src_h, int factor); // Output is (src_w / factor, src_h / factor).
+
+// [Internal]
+// Helper class for simple bitmap manipulation
 struct IMGUI_API ImGuiCaptureImageBuf
 {
     int             Width;
@@ -38,9 +55,15 @@ struct IMGUI_API ImGuiCaptureImageBuf
     ~ImGuiCaptureImageBuf()     { Clear(); }
 
     void Clear();                                           // Free allocated memory buffer if such exists.
-    void CreateEmpty(int w, int h);                         // Reallocate buffer for pixel data and zero it.
-    bool SaveFile(const char* filename);                    // Save pixel data to specified image file.
+    void CreateEmpty(int w, int h);                         // Reallocate buffer for pixel data (unless same size) and zero it.
+    void CreateFromCrop(const ImGuiCaptureImageBuf* src, int x, int y, int w, int h); // Copy a portion of another image.
+    void CreateDownscaled(const ImGuiCaptureImageBuf* src, int factor); // Box filter another image by an integer factor (e.g. for thumbnails).
+    bool LoadFile(const char* filename);                    // Load pixel data from specified image file (PNG: 8-bit, non-interlaced, or QOI).
+    bool SaveFile(const char* filename);                    // Save pixel data to specified image file. Format is selected by extension: .png, .qoi (fast lossless), .bmp, .tga. Fail on other extensions.
     void RemoveAlpha();                                     // Clear alpha channel from all pixels.
+    void FlipVertical();                                    // Reverse order of rows.
+    void SwizzleRB();                                       // Convert between RGBA and BGRA.
+    void Premultiply();                                     // Multiply color by alpha.
 };
 
 enum ImGuiCaptureFlags_ : unsigned int
@@ -51,7 +74,20 @@ enum ImGuiCaptureFlags_ : unsigned int
     ImGuiCaptureFlags_IncludeTooltipsAndPopups  = 1 << 2,   // Expand capture area to automatically include visible popups and tooltips (use with ImGuiCaptureflags_HideOtherWindows)
     ImGuiCaptureFlags_HideMouseCursor           = 1 << 3,   // Hide render software mouse cursor during capture.
     ImGuiCaptureFlags_Instant                   = 1 << 4,   // Perform capture on very same frame. Only works when capturing a rectangular region. Unsupported features: content stitching, window hiding, window relocation.
-    ImGuiCaptureFlags_NoSave                    = 1 << 5    // Do not save output image.
+    ImGuiCaptureFlags_NoSave                    = 1 << 5,   // Do not save output image.
+    ImGuiCaptureFlags_EnlargeDisplay            = 1 << 6    // With ImGuiCaptureFlags_StitchAll: temporarily enlarge io.DisplaySize to fit entire window, and capture it at once instead of scrolling. Requires a renderer following io.DisplaySize (e.g. Null/Software app backends), otherwise fallback to scrolling.
+};
+
+// Parameters for comparing a captured image with a reference ("golden") image.
+// Set in ImGuiCaptureArgs::InCompare. Result is reported by ImGuiCaptureContext::PollCompareResult().
+struct ImGuiCaptureCompareArgs
+{
+    char                    InGoldenFile[256] = "";         // Golden image file (PNG). Comparison is disabled when empty.
+    char                    InDiffFile[256] = "";           // Diff image is written to this file when comparison fails. (Optional)
+    int                     InTolerance = 0;                // Maximum difference per channel (0..255) for pixels to be considered identical.
+    int                     InMaxDifferentPixels = 0;       // Maximum number of different pixels for comparison to succeed.
+    bool                    InAntiAliasingAware = true;     // Don't count pixels which match a neighbor pixel in the other image (anti-aliasing, sub-pixel offsets).
+    ImVector<ImRect>        InIgnoreRects;                  // Screen rectangles excluded from comparison (e.g. blinking text cursor, timers).
 };
 
 // Defines input and output arguments for capture process.
@@ -67,9 +103,59 @@ struct ImGuiCaptureArgs
     ImGuiCaptureImageBuf*   InOutputImageBuf = NULL;        // _OR_ Output will be saved to image buffer if specified.
     int                     InRecordFPSTarget = 30;         // FPS target for recording videos.
     int                     InSizeAlign = 0;                // Resolution alignment (0 = auto, 1 = no alignment, >= 2 = align width/height to be multiple of given value)
+    void*                   InUserData = NULL;              // Passed back in ImGuiCaptureImageWriterResult once output file is written. (Test engine stores the ImGuiTest* here)
+    ImGuiCaptureCompareArgs InCompare;                      // Compare captured image with a golden image. Not supported for videos and InOutputImageBuf.
 
     // [Output]
     ImVec2                  OutImageSize;                   // Produced image size.
+    int                     OutVideoFramesQueued = 0;       // Number of video frames handed to video encoder.
+    int                     OutVideoFramesDropped = 0;      // Number of video frames dropped because video encoder was falling behind (ImGuiCaptureVideoBackpressure_Drop).
+    int                     OutVideoFramesDuplicated = 0;   // Number of video frames identical to their previous frame.
+    ImVector<ImRect>        OutVideoDamageRects;            // One per queued video frame (see OutVideoFramesQueued): bounding rectangle of pixels which changed since previous queued frame, in image coordinates. Empty rectangle when identical.
+};
+
+// Reported by ImGuiCaptureContext::PollImageWriterResult() once an output file is written.
+struct ImGuiCaptureImageWriterResult
+{
+    char                    Filename[256] = "";
+    bool                    Success = false;
+    float                   DurationMs = 0.0f;              // Time spent encoding and writing the file.
+    void*                   UserData = NULL;                // Copied from ImGuiCaptureArgs::InUserData.
+};
+
+// Reported by ImGuiCaptureContext::PollCompareResult() once a comparison is done.
+struct ImGuiCaptureCompareResult
+{
+    char                    GoldenFile[256] = "";
+    char                    DiffFile[256] = "";             // Written diff image, empty if none.
+    bool                    Success = false;
+    bool                    GoldenMissing = false;          // Golden image could not be loaded.
+    bool                    SizeMismatch = false;           // Captured image and golden image sizes differ.
+    ImVec2                  ImageSize;
+    ImVec2                  GoldenSize;
+    int                     PixelsDifferent = 0;            // Pixels exceeding tolerance.
+    int                     PixelsAntiAliased = 0;          // Pixels exceeding tolerance but matching a neighbor pixel. Not counted in PixelsDifferent.
+    int                     PixelsIgnored = 0;              // Pixels exceeding tolerance within InIgnoreRects. Not counted in PixelsDifferent.
+    int                     MaxChannelDiff = 0;             // Largest difference of a channel over the whole image.
+    ImRect                  DiffRect;                       // Bounding rectangle of different pixels, in image coordinates.
+    float                   DurationMs = 0.0f;              // Time spent comparing (and writing diff image).
+    void*                   UserData = NULL;                // Copied from ImGuiCaptureArgs::InUserData.
+};
+
+// What to do with a recorded video frame when all frame buffers are waiting to be consumed by video encoder.
+enum ImGuiCaptureVideoBackpressure_
+{
+    ImGuiCaptureVideoBackpressure_Block,            // Wait for video encoder. Never lose frames, but may stall recording.
+    ImGuiCaptureVideoBackpressure_Drop,             // Drop new frame. Counted in ImGuiCaptureArgs::OutVideoFramesDropped.
+    ImGuiCaptureVideoBackpressure_Grow              // Allocate an additional frame buffer. Never lose frames nor stall, but memory usage is unbounded.
+};
+
+// What to do with a recorded video frame which is identical to previous frame.
+enum ImGuiCaptureVideoDuplicateFrames_
+{
+    ImGuiCaptureVideoDuplicateFrames_Encode,        // Capture and queue frame as usual.
+    ImGuiCaptureVideoDuplicateFrames_Repeat,        // Writer thread writes previous frame again: same video, without using a frame buffer.
+    ImGuiCaptureVideoDuplicateFrames_Skip           // Don't write frame: video is shortened to changes only (e.g. for GIF previews).
 };
 
 enum ImGuiCaptureStatus
@@ -91,9 +177,17 @@ struct IMGUI_API ImGuiCaptureContext
     int                     VideoCaptureEncoderParamsSize = 0;  // Optional. Set in order to edit this parameter from UI.
     char*                   GifCaptureEncoderParams = NULL;     // Video encoder params for GIF output (not owned, stored externally).
     int                     GifCaptureEncoderParamsSize = 0;    // Optional. Set in order to edit this parameter from UI.
+    int                     ImageWriterThreads = 0;             // Number of worker threads encoding and writing image files in the background. 0: write synchronously in CaptureUpdate().
+    int                     ImageWriterQueueSize = 8;           // Maximum number of images waiting to be written. Capturing blocks when the queue is full, which bounds memory usage.
+    int                     VideoFramesQueueSize = 8;           // Number of preallocated video frame buffers waiting to be fed to video encoder by writer thread.
+    ImGuiCaptureVideoBackpressure VideoBackpressure = ImGuiCaptureVideoBackpressure_Block; // What to do when video encoder falls behind and all frame buffers are queued.
+    ImGuiCaptureVideoDuplicateFrames VideoDuplicateFrames = ImGuiCaptureVideoDuplicateFrames_Repeat; // What to do with frames identical to previous frame.
+    int                     PngCompressionLevel = 8;            // PNG zlib compression level (1..9). Lower is faster but produces larger files. Saving as .qoi is faster still.
+    int                     PngFilter = -1;                     // PNG scanline filter (0..4: None, Sub, Up, Average, Paeth), -1: try all filters for each scanline and keep smallest output (slowest).
 
     // [Internal]
     ImRect                  _CaptureRect;                   // Viewport rect that is being captured.
+    ImVec2                  _CaptureImageOrigin;            // Screen position of top-left pixel of output image.
     ImRect                  _CapturedWindowRect;            // Top-left corner of region that covers all windows included in capture. This is not same as _CaptureRect.Min when capturing explicitly specified rect.
     int                     _ChunkNo = 0;                   // Number of chunk that is being captured when capture spans multiple frames.
     int                     _FrameNo = 0;                   // Frame number during capture process that spans multiple frames.
@@ -102,10 +196,17 @@ struct IMGUI_API ImGuiCaptureContext
     ImGuiCaptureImageBuf    _CaptureBuf;                    // Output image buffer.
     const ImGuiCaptureArgs* _CaptureArgs = NULL;            // Current capture args. Set only if capture is in progress.
 
+    // [Internal] Image writer
+    ImGuiCaptureImageWriter* _ImageWriter = NULL;           // Worker threads and job slots. Created on first use when ImageWriterThreads > 0.
+    ImVector<ImGuiCaptureImageWriterResult> _ImageWriterResults; // Completed writes not yet polled.
+    ImVector<ImGuiCaptureCompareResult> _CompareResults;    // Completed comparisons not yet polled.
+    ImVector<ImGuiCaptureGoldenImage*> _GoldenImages;       // Golden images cache.
+
     // [Internal] Video recording
     bool                    _VideoRecording = false;        // Flag indicating that video recording is in progress.
     double                  _VideoLastFrameTime = 0;        // Time when last video frame was recorded.
-    FILE*                   _VideoEncoderPipe = NULL;        // File writing to stdin of video encoder process.
+    ImGuiCaptureVideoWriter* _VideoWriter = NULL;           // Writer thread feeding stdin of video encoder process. Created on first recorded frame.
+    ImVector<ImGuiCaptureVideoWriter*> _VideoWritersFinalizing; // Writers completing their queue and waiting for video encoder to exit.
 
     // [Internal] Backups
     bool                    _BackupMouseDrawCursor = false; // Initial value of g.IO.MouseDrawCursor
@@ -113,12 +214,15 @@ struct IMGUI_API ImGuiCaptureContext
     ImVector<ImRect>        _BackupWindowsRect;             // Backup window state that will be restored when screen capturing is done. Size and order matches windows of ImGuiCaptureArgs::InCaptureWindows.
     ImVec2                  _BackupDisplayWindowPadding;    // Backup padding. We set it to {0, 0} during capture.
     ImVec2                  _BackupDisplaySafeAreaPadding;  // Backup padding. We set it to {0, 0} during capture.
+    ImVec2                  _BackupDisplaySize;             // Backup io.DisplaySize when enlarged by ImGuiCaptureFlags_EnlargeDisplay.
+    bool                    _DisplayEnlarged = false;       // io.DisplaySize is enlarged, window is captured in a single chunk.
 
     //-------------------------------------------------------------------------
     // Functions
     //-------------------------------------------------------------------------
 
     ImGuiCaptureContext(ImGuiScreenCaptureFunc capture_func = NULL) { ScreenCaptureFunc = capture_func; _MouseRelativeToWindowPos = ImVec2(-FLT_MAX, -FLT_MAX); }
+    ~ImGuiCaptureContext()  { ShutdownImageWriter(); ClearGoldenImages(); }
 
     // These functions should be called from appropriate context hooks. See ImGui::AddContextHook() for more info.
     // (ImGuiTestEngine automatically calls that for you, so this only apply to independently created instance)
@@ -128,12 +232,33 @@ struct IMGUI_API ImGuiCaptureContext
 
     // Update capturing. If this function returns true then it should be called again with same arguments on the next frame.
     ImGuiCaptureStatus      CaptureUpdate(ImGuiCaptureArgs* args);
+    void                    _EndCapture();                  // Restore windows and display modified during capture, reset capture state.
 
     // Begin video capture. Call CaptureUpdate() every frame afterwards until it returns false.
     void                    BeginVideoCapture(ImGuiCaptureArgs* args);
     void                    EndVideoCapture();
     bool                    IsCapturingVideo();
     bool                    IsCapturing();
+    void                    _CreateVideoWriter(FILE* output, bool output_is_process, int width, int height, const ImGuiCaptureArgs* args); // Start writer thread feeding raw frames to 'output': encoder stdin (ImOsPOpen()), or a regular file (e.g. tests).
+    void                    _QueueVideoFrame(ImGuiCaptureImageBuf* image, ImGuiCaptureArgs* args);  // Hand over image pixels (swapped with a free frame buffer) to writer thread.
+    void                    _PauseVideoWriter(bool paused);                                         // Stop/resume writing frames, which fills the frame queue as a slow video encoder would (e.g. tests).
+    void                    _FinalizeVideoWriter(bool failed = false);                              // Writer thread writes remaining frames and closes output in background. Result is reported by PollImageWriterResult(), as failed when 'failed' is set.
+
+    // Image writer. Captured images are saved by worker threads when ImageWriterThreads > 0.
+    // Videos are finalized in background after EndVideoCapture(), and reported through PollImageWriterResult() as well.
+    bool                    PollImageWriterResult(ImGuiCaptureImageWriterResult* out_result);   // Return true and fill 'out_result' for each completed write. Call regularly from main thread.
+    void                    FlushImageWriter();                                                 // Block until all queued images are written and all finalizing videos are complete.
+    void                    ShutdownImageWriter();                                              // Flush and stop worker threads.
+    int                     ConvertImageFilesToPng(const char* const* filenames, int count);   // Write .png files next to other image files (e.g. .qoi captures) for publishing, one result each. Return number of files converted.
+    void                    _QueueImageWrite(ImGuiCaptureImageBuf* image, const ImGuiCaptureArgs* args); // Take ownership of image pixels and write them to args->InOutputFile.
+    void                    _CreateImageWriterThreads();
+    void                    _DestroyImageWriterThreads();
+
+    // Golden image comparison. Captures with ImGuiCaptureArgs::InCompare set are compared by image writer threads (or synchronously).
+    bool                    PollCompareResult(ImGuiCaptureCompareResult* out_result);           // Return true and fill 'out_result' for each completed comparison. FlushImageWriter() waits for pending comparisons.
+    const ImGuiCaptureImageBuf* GetGoldenImage(const char* filename);                           // Load golden image on first use and cache it. Return NULL if it can't be loaded.
+    void                    ClearGoldenImages();                                                // Release cached golden images (e.g. after updating them).
+    void                    _QueueImageCompare(ImGuiCaptureImageBuf* image, const ImGuiCaptureArgs* args); // Take ownership of image pixels and compare them with args->InCompare.InGoldenFile.
 };
 
 //-----------------------------------------------------------------------------
@@ -114,25 +114,18 @@ void    ImGuiTestContext::LogExV(ImGuiTestVerboseLevel level, ImGuiTestLogFlags
     if (EngineIO->ConfigVerboseLevelOnError < level)
         return;
 
+    // Record line without formatting it. Only format right away if it is going to be printed.
     ImGuiTestLog* log = &test->TestLog;
-    const int prev_size = log->Buffer.size();
-
-    //const char verbose_level_char = ImGuiTestEngine_GetVerboseLevelName(level)[0];
-    //if (flags & ImGuiTestLogFlags_NoHeader)
-    //    log->Buffer.appendf("[%c] ", verbose_level_char);
-    //else
-    //    log->Buffer.appendf("[%c] [%04d] ", verbose_level_char, ctx->FrameCount);
-    if ((flags & ImGuiTestLogFlags_NoHeader) == 0)
-        log->Buffer.appendf("[%04d] ", ctx->FrameCount);
-
-    if (level >= ImGuiTestVerboseLevel_Debug)
-        log->Buffer.appendf("-- %*s", ImMax(0, (ctx->ActionDepth - 1) * 2), "");
-    log->Buffer.appendfv(fmt, args);
-    log->Buffer.append("\n");
-
-    log->UpdateLineOffsets(EngineIO, level, log->Buffer.begin() + prev_size);
-    LogToTTY(level, log->Buffer.c_str() + prev_size);
-    LogToDebugger(level, log->Buffer.c_str() + prev_size);
+    const int line_no = log->AddLineV(level, flags, ctx->FrameCount, ctx->ActionDepth, fmt, args);
+    const bool print_to_tty = EngineIO->ConfigLogToTTY && (test->Status == ImGuiTestStatus_Error || level <= EngineIO->ConfigVerboseLevel);
+    const bool print_to_debugger = EngineIO->ConfigLogToDebugger && level <= EngineIO->ConfigVerboseLevel;
+    if (!print_to_tty && !print_to_debugger)
+        return;
+    LogLineBuffer.Buf.resize(0);
+    for (int n = line_no; n < log->LineInfo.Size; n++)
+        log->FormatLine(n, &LogLineBuffer);
+    LogToTTY(level, LogLineBuffer.c_str());
+    LogToDebugger(level, LogLineBuffer.c_str());
 }
 
 void    ImGuiTestContext::LogDebug(const char* fmt, ...)
@@ -186,14 +179,15 @@ void    ImGuiTestContext::LogToTTY(ImGuiTestVerboseLevel level, const char* mess
             // Print all previous logged messages first
             // FIXME: Can't use ExtractLinesAboveVerboseLevel() because we want to keep error level...
             CachedLinesPrintedToTTY = true;
+            ImGuiTextBuffer line_buf;
             for (int i = 0; i < log->LineInfo.Size; i++)
             {
                 ImGuiTestLogLineInfo& line_info = log->LineInfo[i];
                 if (line_info.Level > EngineIO->ConfigVerboseLevelOnError)
                     continue;
-                char* line_begin = log->Buffer.Buf.Data + line_info.LineOffset;
-                char* line_end = strchr(line_begin, '\n');
-                LogToTTY(line_info.Level, line_begin, line_end + 1);
+                line_buf.Buf.resize(0);
+                log->FormatLine(i, &line_buf);
+                LogToTTY(line_info.Level, line_buf.c_str());
             }
             // We already printed current line as well, so return now.
             return;
@@ -274,8 +268,8 @@ void    ImGuiTestContext::LogBasicUiState()
 
 void    ImGuiTestContext::LogItemList(ImGuiTestItemList* items)
 {
-    for (const ImGuiTestItemInfo& info : *items)
-        LogDebug("- 0x%08X: depth %d: '%s' in window '%s'\n", info.ID, info.Depth, info.DebugLabel, info.Window->Name);
+    for (int n = 0; n < items->GetSize(); n++)
+        LogDebug("- 0x%08X: depth %d: '%s' in window '%s'\n", items->IDs[n], items->Depths[n], items->GetLabel(n), items->Windows[n]->Name);
 }
 
 void    ImGuiTestContext::Finish()
@@ -389,11 +383,26 @@ void    ImGuiTestContext::Sleep(float time)
 // This is useful when you need to wait a certain amount of time (even in Fast mode)
 // Sleep for a given clock time from the point of view of the Dear ImGui context, without affecting wall clock time of the running application.
 // FIXME: This makes sense for apps only relying on io.DeltaTime.
-void    ImGuiTestContext::SleepNoSkip(float time, float framestep_in_second)
+// With ImGuiTestSleepPolicy_Jump, the last few frames are still stepped so Dear ImGui can react to timers
+// crossing their threshold during the large frame (e.g. open a tooltip after hover delay has elapsed).
+void    ImGuiTestContext::SleepNoSkip(float time, float framestep_in_second, ImGuiTestSleepPolicy policy)
 {
     if (IsError())
         return;
 
+    if (policy == ImGuiTestSleepPolicy_Jump)
+    {
+        const int settle_frames = 2;
+        const float jump_time = time - framestep_in_second * settle_frames;
+        if (jump_time > framestep_in_second)
+        {
+            LogEx(ImGuiTestVerboseLevel_Trace, ImGuiTestLogFlags_None, "SleepNoSkip(%.2f) -> jump %.2f", time, jump_time);
+            ImGuiTestEngine_SetDeltaTime(Engine, jump_time);
+            ImGuiTestEngine_Yield(Engine);
+            time -= UiContext->IO.DeltaTime;
+        }
+    }
+
     while (time > 0.0f && !Abort)
     {
         ImGuiTestEngine_SetDeltaTime(Engine, framestep_in_second);
@@ -677,7 +686,7 @@ bool ImGuiTestContext::CaptureScreenshot(int capture_flags)
     args->InFlags = capture_flags;
 
     // Auto filename
-    CaptureInitAutoFilename(this, ".png");
+    CaptureInitAutoFilename(this, EngineIO->ImageCaptureExtension);
 
 #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
     bool can_capture = ImGuiTestContext_CanCaptureScreenshot(this);
@@ -685,7 +694,7 @@ bool ImGuiTestContext::CaptureScreenshot(int capture_flags)
         args->InFlags |= ImGuiCaptureFlags_NoSave;
     bool ret = ImGuiTestEngine_CaptureScreenshot(Engine, args);
     if (can_capture)
-        LogInfo("Saved '%s' (%d*%d pixels)", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
+        LogInfo("%s '%s' (%d*%d pixels)", (EngineIO->ConfigCaptureWriterThreads > 0) ? "Queued" : "Saved", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
     else
         LogWarning("Skipped saving '%s' (%d*%d pixels) (enable in 'Misc->Options')", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
     return ret;
@@ -696,6 +705,52 @@ bool ImGuiTestContext::CaptureScreenshot(int capture_flags)
 #endif
 }
 
+// Compare with a golden image. With io.ConfigCaptureUpdateGoldens, write golden image instead.
+// Comparison may run in background: a failure marks the test as failed when comparison is done (at the latest by end of test).
+bool ImGuiTestContext::CaptureCompare(const char* name, int capture_flags)
+{
+    if (IsError())
+        return false;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    LogInfo("CaptureCompare(\"%s\")", name);
+    ImGuiCaptureArgs* args = CaptureArgs;
+    args->InFlags = capture_flags;
+
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+    Str256f golden_file("%s/%s.png", EngineIO->CaptureGoldensDir, name);
+    if (EngineIO->ConfigCaptureUpdateGoldens)
+    {
+        args->InFlags &= ~ImGuiCaptureFlags_NoSave;
+        ImStrncpy(args->InOutputFile, golden_file.c_str(), IM_ARRAYSIZE(args->InOutputFile));
+        bool ret = ImGuiTestEngine_CaptureScreenshot(Engine, args);
+        Engine->CaptureContext.ClearGoldenImages(); // Flush and reload on next comparison
+        LogInfo("Updated golden image '%s' (%d*%d pixels)", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
+        args->InOutputFile[0] = 0;
+        return ret;
+    }
+
+    ImGuiCaptureCompareArgs* compare_args = &args->InCompare;
+    ImStrncpy(compare_args->InGoldenFile, golden_file.c_str(), IM_ARRAYSIZE(compare_args->InGoldenFile));
+    ImFormatString(compare_args->InDiffFile, IM_ARRAYSIZE(compare_args->InDiffFile), "output/captures/%s_diff.png", name);
+    if (ImGuiTestContext_CanCaptureScreenshot(this))
+        ImFormatString(args->InOutputFile, IM_ARRAYSIZE(args->InOutputFile), "output/captures/%s.png", name);
+    else
+        args->InFlags |= ImGuiCaptureFlags_NoSave;
+    bool ret = ImGuiTestEngine_CaptureScreenshot(Engine, args);
+    if (ret)
+        CaptureComparesQueued++;
+    LogDebug("%s comparison with '%s' (%d*%d pixels)", (EngineIO->ConfigCaptureWriterThreads > 0) ? "Queued" : "Done", compare_args->InGoldenFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
+    compare_args->InGoldenFile[0] = 0; // Following ctx->CaptureScreenshot() calls don't compare nor overwrite this capture
+    args->InOutputFile[0] = 0;
+    return ret;
+#else
+    IM_UNUSED(args);
+    LogWarning("Skipped comparing '%s': capture disabled by IMGUI_TEST_ENGINE_ENABLE_CAPTURE=0.", name);
+    return false;
+#endif
+}
+
 void ImGuiTestContext::CaptureReset()
 {
     *CaptureArgs = ImGuiCaptureArgs();
@@ -768,7 +823,9 @@ bool ImGuiTestContext::CaptureEndVideo()
     bool can_capture = ImGuiTestContext_CanCaptureVideo(this);
     if (can_capture)
     {
-        LogInfo("Saved '%s' (%d*%d pixels)", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y);
+        LogInfo("Saved '%s' (%d*%d pixels, %d frames, %d dropped, %d duplicated)", args->InOutputFile, (int)args->OutImageSize.x, (int)args->OutImageSize.y, args->OutVideoFramesQueued, args->OutVideoFramesDropped, args->OutVideoFramesDuplicated);
+        if (args->OutVideoFramesDropped > 0)
+            LogWarning("Video encoder was too slow: dropped %d frames.", args->OutVideoFramesDropped);
     }
     else
     {
@@ -1949,7 +2006,10 @@ void    ImGuiTestContext::MouseDown(ImGuiMouseButton button)
 
     UiContext->IO.MouseClickedTime[button] = -FLT_MAX; // Prevent accidental double-click from happening ever
     Inputs->MouseButtonsValue |= (1 << button);
-    Yield();
+    if (IsInputBurst())
+        Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, true));
+    else
+        Yield();
 }
 
 void    ImGuiTestContext::MouseUp(ImGuiMouseButton button)
@@ -1963,7 +2023,10 @@ void    ImGuiTestContext::MouseUp(ImGuiMouseButton button)
         SleepShort();
 
     Inputs->MouseButtonsValue &= ~(1 << button);
-    Yield();
+    if (IsInputBurst())
+        Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, false));
+    else
+        Yield();
 }
 
 // TODO: click time argument (seconds and/or frames)
@@ -1989,6 +2052,18 @@ void    ImGuiTestContext::MouseClickMulti(ImGuiMouseButton button, int count)
     // Make sure mouse buttons are released
     IM_ASSERT(count >= 1);
     IM_ASSERT(Inputs->MouseButtonsValue == 0);
+
+    // Queue all transitions, EndInputBurst() will let them trickle
+    if (IsInputBurst())
+    {
+        UiContext->IO.MouseClickedTime[button] = -FLT_MAX;
+        for (int n = 0; n < count; n++)
+        {
+            Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, true));
+            Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, false));
+        }
+        return;
+    }
     Yield();
 
     // Press
@@ -2288,6 +2363,8 @@ void    ImGuiTestContext::KeyDown(ImGuiKeyChord key_chord)
         SleepShort();
 
     Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, true));
+    if (IsInputBurst())
+        return;
     Yield();
     Yield();
 }
@@ -2305,6 +2382,8 @@ void    ImGuiTestContext::KeyUp(ImGuiKeyChord key_chord)
         SleepShort();
 
     Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, false));
+    if (IsInputBurst())
+        return;
     Yield();
     Yield();
 }
@@ -2325,6 +2404,11 @@ void    ImGuiTestContext::KeyPress(ImGuiKeyChord key_chord, int count)
     {
         count--;
         Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, true));
+        if (IsInputBurst())
+        {
+            Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, false));
+            continue;
+        }
         if (EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Cinematic)
             SleepShort();
         else
@@ -2349,8 +2433,14 @@ void    ImGuiTestContext::KeyHold(ImGuiKeyChord key_chord, float time)
     if (EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Cinematic)
         SleepStandard();
 
+    // With a virtual clock, step at key repeat rate: every repeat is still seen by Dear ImGui, in less frames.
+    // This costs about 'time / io.KeyRepeatRate' frames (e.g. 40 frames for 2 seconds at default rate, instead of 200).
+    // We don't jump like ImGuiTestSleepPolicy_Jump does: a large frame would collapse many repeats into a single IsKeyPressed().
+    float framestep = 1 / 100.0f;
+    if (ImGuiTestEngine_IsUsingVirtualClock(Engine))
+        framestep = ImMax(framestep, UiContext->IO.KeyRepeatRate);
     Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, true));
-    SleepNoSkip(time, 1 / 100.0f);
+    SleepNoSkip(time, framestep);
     Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, false));
     Yield(); // Give a frame for items to react
 }
@@ -2376,7 +2466,8 @@ void    ImGuiTestContext::KeyChars(const char* chars)
         if (EngineIO->ConfigRunSpeed != ImGuiTestRunSpeed_Fast)
             Sleep(1.0f / EngineIO->TypingSpeed);
     }
-    Yield();
+    if (!IsInputBurst())
+        Yield();
 }
 
 void    ImGuiTestContext::KeyCharsAppend(const char* chars)
@@ -2431,13 +2522,49 @@ void    ImGuiTestContext::KeyCharsReplaceEnter(const char* chars)
     KeyPress(ImGuiKey_Enter);
 }
 
+void    ImGuiTestContext::BeginInputBurst()
+{
+    IM_ASSERT(!InputBurst && "Nested BeginInputBurst() calls are not supported!");
+    InputBurst = true;
+}
+
+static bool HasPendingTestEngineInputEvents(ImGuiContext* ui_ctx)
+{
+    for (const ImGuiInputEvent& e : ui_ctx->InputEventsQueue)
+        if (e.AddedByTestEngine)
+            return true;
+    return false;
+}
+
+void    ImGuiTestContext::EndInputBurst()
+{
+    IM_ASSERT(InputBurst && "Mismatched BeginInputBurst()/EndInputBurst() calls!");
+    const bool was_burst = IsInputBurst();
+    InputBurst = false;
+    if (IsError() || !was_burst)
+        return;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    const int inputs_count = Inputs->Queue.Size;
+    const int frame_count_start = FrameCount;
+
+    // Submit whole queue in next NewFrame(), then keep running while Dear ImGui is trickling events over following frames.
+    Yield();
+    while (!Abort && HasPendingTestEngineInputEvents(UiContext))
+        Yield();
+
+    // Give a frame for items to react
+    Yield();
+    LogDebug("EndInputBurst: %d inputs in %d frames", inputs_count, FrameCount - frame_count_start);
+}
+
 // depth = 1 -> immediate child of 'parent' in ID Stack
 void    ImGuiTestContext::GatherItems(ImGuiTestItemList* out_list, ImGuiTestRef parent, int depth)
 {
     IM_ASSERT(out_list != NULL);
     IM_ASSERT(depth > 0 || depth == -1);
     IM_ASSERT(GatherTask->InParentID == 0);
-    IM_ASSERT(GatherTask->LastItemInfo == NULL);
+    IM_ASSERT(GatherTask->LastItemID == 0);
 
     if (IsError())
         return;
@@ -2465,8 +2592,7 @@ void    ImGuiTestContext::GatherItems(ImGuiTestItemList* out_list, ImGuiTestRef
     }
     const int end_gather_size = out_list->GetSize();
 
-    // FIXME-TESTS: To support filter we'd need to process the list here,
-    // Because ImGuiTestItemList is a pool (ImVector + map ID->index) we'll need to filter, rewrite, rebuild map
+    // Filtering is left to the caller: ImGuiTestItemList::FilterByXXX() functions output index spans without rebuilding the list.
 
     ImGuiTestItemInfo* parent_item = ItemInfo(parent, ImGuiTestOpFlags_NoError);
     LogDebug("GatherItems from %s, %d deep: found %d items.", ImGuiTestRefDesc(parent, parent_item).c_str(), depth, end_gather_size - begin_gather_size);
@@ -2666,24 +2792,30 @@ void    ImGuiTestContext::ItemActionAll(ImGuiTestAction action, ImGuiTestRef ref
         //LogItemList(&items);
 
         // Find deep most items
+        ImVector<int> indices;
         int highest_depth = -1;
         if (action == ImGuiTestAction_Close)
-            for (auto& item : items)
-                if ((item.StatusFlags & ImGuiItemStatusFlags_Openable) && (item.StatusFlags & ImGuiItemStatusFlags_Opened)) // Not checking Disabled state here
-                    highest_depth = ImMax(highest_depth, item.Depth);
+        {
+            items.FilterByStatusFlags(&indices, ImGuiItemStatusFlags_Openable | ImGuiItemStatusFlags_Opened); // Not checking Disabled state here
+            for (int n : indices)
+                highest_depth = ImMax(highest_depth, (int)items.Depths[n]);
+        }
+
+        // Apply status filter
+        items.FilterByStatusFlags(&indices, filter ? filter->RequireAllStatusFlags : 0);
 
         const int actioned_total_at_beginning_of_pass = actioned_total;
 
         // Process top-to-bottom in most cases
         int scan_start = 0;
-        int scan_end = items.GetSize();
+        int scan_end = indices.Size;
         int scan_dir = +1;
         if (action == ImGuiTestAction_Close)
         {
             // Close bottom-to-top because
             // 1) it is more likely to handle same-depth parent/child relationship better (e.g. CollapsingHeader)
             // 2) it gives a nicer sense of symmetry with the corresponding open operation.
-            scan_start = items.GetSize() - 1;
+            scan_start = indices.Size - 1;
             scan_end = -1;
             scan_dir = -1;
         }
@@ -2691,16 +2823,13 @@ void    ImGuiTestContext::ItemActionAll(ImGuiTestAction action, ImGuiTestRef ref
         int processed_count_per_depth[8];
         memset(processed_count_per_depth, 0, sizeof(processed_count_per_depth));
 
-        for (int n = scan_start; n != scan_end; n += scan_dir)
+        for (int scan_n = scan_start; scan_n != scan_end; scan_n += scan_dir)
         {
             if (IsError())
                 break;
 
-            const ImGuiTestItemInfo& item = *items[n];
-
-            if (filter && filter->RequireAllStatusFlags != 0)
-                if ((item.StatusFlags & filter->RequireAllStatusFlags) != filter->RequireAllStatusFlags)
-                    continue;
+            ImGuiTestItemInfo item;
+            items.GetItemInfo(indices[scan_n], &item);
 
             if (filter && filter->RequireAnyStatusFlags != 0)
                 if ((item.StatusFlags & filter->RequireAnyStatusFlags) != 0)
@@ -2808,6 +2937,8 @@ void    ImGuiTestContext::ItemInputValue(ImGuiTestRef ref, const char* value)
     KeyCharsReplaceEnter(value);
 }
 
+// Hold uses Sleep() rather than SleepNoSkip(..., ImGuiTestSleepPolicy_Jump): it is mostly used on repeating buttons,
+// whose every repeat needs to be seen in a frame of its own. Like other Sleep() calls, this is a single frame in Fast mode.
 void    ImGuiTestContext::ItemHold(ImGuiTestRef ref, float time)
 {
     if (IsError())
@@ -2861,8 +2992,10 @@ void    ImGuiTestContext::ItemDragOverAndHold(ImGuiTestRef ref_src, ImGuiTestRef
     // Enforce lifting drag threshold even if both item are exactly at the same location.
     MouseLiftDragThreshold();
 
+    // Only the hover-to-open timer crossing its threshold matters here: jump over most of the hold.
+    // Since 1.0 seconds are elapsed in 3 frames instead of 10, widgets reacting to each frame of a drag-over see fewer frames.
     MouseMove(ref_dst, ImGuiTestOpFlags_NoCheckHoveredId);
-    SleepNoSkip(1.0f, 1.0f / 10.0f);
+    SleepNoSkip(1.0f, 1.0f / 10.0f, ImGuiTestSleepPolicy_Jump);
     MouseUp(0);
 }
 
@@ -3121,15 +3254,15 @@ void    ImGuiTestContext::MenuActionAll(ImGuiTestAction action, ImGuiTestRef ref
     GatherItems(&items, "//$FOCUSED", 1);
     //LogItemList(&items);
 
-    for (auto item : items)
+    for (ImGuiID item_id : items.IDs)
     {
         MenuAction(ImGuiTestAction_Open, ref_parent); // We assume that every interaction will close the menu again
 
         if (action == ImGuiTestAction_Check || action == ImGuiTestAction_Uncheck)
-            if ((ItemInfo(item.ID)->StatusFlags & ImGuiItemStatusFlags_Checkable) == 0)
+            if ((ItemInfo(item_id)->StatusFlags & ImGuiItemStatusFlags_Checkable) == 0)
                 continue;
 
-        ItemAction(action, item.ID);
+        ItemAction(action, item_id);
     }
 }
 
@@ -3175,10 +3308,10 @@ void    ImGuiTestContext::ComboClickAll(ImGuiTestRef ref_parent)
 
     ImGuiTestItemList items;
     GatherItems(&items, "//$FOCUSED");
-    for (auto item : items)
+    for (ImGuiID item_id : items.IDs)
     {
         ItemClick(ref_parent); // We assume that every interaction will close the combo again
-        ItemClick(item.ID);
+        ItemClick(item_id);
     }
 }
 
@@ -3715,6 +3848,39 @@ void    ImGuiTestContext::UndockWindow(const char* window_name)
 // ImGuiTestContext - Performance Tools
 //-------------------------------------------------------------------------
 
+// Append a result to perf log and to test results (for exporters)
+static void PerfAppendResult(ImGuiTestContext* ctx, const char* category, const char* test_name, double dt_ref_ms, double dt_delta_ms, int perf_iterations, const char* csv_file)
+{
+    const ImBuildInfo* build_info = ImBuildGetCompilationInfo();
+
+    ImGuiPerfToolEntry entry;
+    entry.Timestamp = ctx->Engine->BatchStartTime;
+    entry.Category = category ? category : ctx->Test->Category;
+    entry.TestName = test_name ? test_name : ctx->Test->Name;
+    entry.DtDeltaMs = dt_delta_ms;
+    entry.PerfStressAmount = ctx->PerfStressAmount;
+    entry.GitBranchName = ctx->EngineIO->GitBranchName;
+    entry.BuildType = build_info->Type;
+    entry.Cpu = build_info->Cpu;
+    entry.OS = build_info->OS;
+    entry.Compiler = build_info->Compiler;
+    entry.Date = build_info->Date;
+    ImGuiTestEngine_PerfToolAppendToCSV(ctx->Engine->PerfTool, &entry, csv_file);
+
+    // Keep result for exporters
+    ImGuiTestPerfCaptureResult result;
+    ImStrncpy(result.Category, entry.Category, IM_ARRAYSIZE(result.Category));
+    ImStrncpy(result.TestName, entry.TestName, IM_ARRAYSIZE(result.TestName));
+    result.DtRefMs = dt_ref_ms;
+    result.DtDeltaMs = dt_delta_ms;
+    result.PerfStressAmount = ctx->PerfStressAmount;
+    result.PerfIterations = perf_iterations;
+    ctx->Test->PerfCaptures.push_back(result);
+
+    // Disable the "Success" message
+    ctx->RunFlags |= ImGuiTestRunFlags_NoSuccessMsg;
+}
+
 // Calculate the reference DeltaTime, averaged over PerfIterations/500 frames, with GuiFunc disabled.
 void    ImGuiTestContext::PerfCalcRef()
 {
@@ -3767,22 +3933,72 @@ void    ImGuiTestContext::PerfCapture(const char* category, const char* test_nam
         PerfStressAmount, build_info->Type, build_info->Cpu, build_info->OS, build_info->Compiler, build_info->Date);
     LogInfo("[PERF] Result: %+6.3f ms (from ref %+6.3f)", dt_delta_ms, dt_ref_ms);
 
-    ImGuiPerfToolEntry entry;
-    entry.Timestamp = Engine->BatchStartTime;
-    entry.Category = category ? category : Test->Category;
-    entry.TestName = test_name ? test_name : Test->Name;
-    entry.DtDeltaMs = dt_delta_ms;
-    entry.PerfStressAmount = PerfStressAmount;
-    entry.GitBranchName = EngineIO->GitBranchName;
-    entry.BuildType = build_info->Type;
-    entry.Cpu = build_info->Cpu;
-    entry.OS = build_info->OS;
-    entry.Compiler = build_info->Compiler;
-    entry.Date = build_info->Date;
-    ImGuiTestEngine_PerfToolAppendToCSV(Engine->PerfTool, &entry, csv_file);
+    PerfAppendResult(this, category, test_name, dt_ref_ms, dt_delta_ms, PerfIterations, csv_file);
+}
 
-    // Disable the "Success" message
-    RunFlags |= ImGuiTestRunFlags_NoSuccessMsg;
+// Record a value measured by the test itself (e.g. latency of an operation), instead of the average frame time.
+void    ImGuiTestContext::PerfCaptureValue(const char* category, const char* test_name, double value_ms, const char* csv_file)
+{
+    if (IsError())
+        return;
+    LogInfo("[PERF] Result: %+6.3f ms (%s)", value_ms, test_name ? test_name : Test->Name);
+    PerfAppendResult(this, category, test_name, 0.0, value_ms, 0, csv_file);
+}
+
+// Perf tool entries reference names by pointer: keep names generated at runtime alive until engine shutdown.
+static const char* PerfGetPersistentName(ImGuiTestEngine* engine, const char* name)
+{
+    for (char* pooled_name : engine->PerfNamesPool)
+        if (strcmp(pooled_name, name) == 0)
+            return pooled_name;
+    engine->PerfNamesPool.push_back(ImStrdup(name));
+    return engine->PerfNamesPool.back();
+}
+
+static int IMGUI_CDECL MicroBenchComparerU64(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs;
+    const ImU64 b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Run a micro-benchmark kernel back-to-back within the current frame, without involving frame times or PerfRefDt.
+// - Warmup batches are run first and discarded (caches, branch predictors, CPU clock ramping up).
+// - Each batch times MicroBenchIterations calls with a nanosecond clock. The median batch is kept, as it is robust to preemption.
+// - Result is stored in the "ms" column of the perf log as nanoseconds per call ("_ns_op" name suffix), so lower is better like other entries.
+// - Use ImDoNotOptimize() in kernels to prevent the compiler from eliding the measured work.
+void    ImGuiTestContext::MicroBench(const char* test_name, ImFuncPtr(ImGuiTestMicroBenchFunc) func, ImFuncPtr(ImGuiTestMicroBenchFunc) reset_func, void* user_data)
+{
+    IM_ASSERT(func != NULL);
+    if (IsError())
+        return;
+    if (test_name == NULL)
+        test_name = Test->Name;
+
+    const int iterations = ImMax(MicroBenchIterations, 1);
+    const int batches_count = ImMax(MicroBenchBatches * ImMax(PerfStressAmount, 1), 1);
+    ImVector<ImU64> batches_ns;
+    batches_ns.reserve(batches_count);
+    for (int batch_n = -MicroBenchWarmupBatches; batch_n < batches_count && !Abort; batch_n++)
+    {
+        if (reset_func != NULL)
+            reset_func(user_data);
+        const ImU64 t0 = ImTimeGetInNanoseconds();
+        for (int n = 0; n < iterations; n++)
+            func(user_data);
+        const ImU64 t1 = ImTimeGetInNanoseconds();
+        if (batch_n >= 0)
+            batches_ns.push_back(t1 - t0);
+    }
+    if (Abort)
+        return;
+
+    ImQsort(batches_ns.Data, (size_t)batches_ns.Size, sizeof(ImU64), MicroBenchComparerU64);
+    const double ns_per_op = (double)batches_ns[batches_ns.Size / 2] / iterations;
+    const double mops_per_s = (ns_per_op > 0.0) ? 1000.0 / ns_per_op : 0.0;
+    LogInfo("[PERF] Result: %.3f ns/op, %.3f Mops/s (%s, %d batches x %d iterations)", ns_per_op, mops_per_s, test_name, batches_count, iterations);
+
+    PerfAppendResult(this, NULL, PerfGetPersistentName(Engine, Str256f("%s_ns_op", test_name).c_str()), 0.0, ns_per_op, batches_count * iterations, NULL);
 }
 
 //-------------------------------------------------------------------------
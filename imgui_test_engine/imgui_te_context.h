@@ -47,6 +47,7 @@ Index of this file:
 
 // This file
 typedef int ImGuiTestOpFlags;       // Flags: See ImGuiTestOpFlags_
+typedef void (ImGuiTestMicroBenchFunc)(void* user_data); // Kernel for ImGuiTestContext::MicroBench()
 
 // External: imgui
 struct ImGuiDockNode;
@@ -129,6 +130,13 @@ enum ImGuiTestOpFlags_
     ImGuiTestOpFlags_MoveToEdgeD        = 1 << 10,
 };
 
+// How SleepNoSkip() advances simulated time
+enum ImGuiTestSleepPolicy
+{
+    ImGuiTestSleepPolicy_Step,      // Step frames of 'framestep_in_second' until time has passed. Every frame in between is observed (e.g. each key repeat, nav repeat).
+    ImGuiTestSleepPolicy_Jump,      // Advance most of the time in a single frame, then step the last frames. Only state transitions are observed (e.g. hover delays, hold-to-open, timeouts), in much fewer frames.
+};
+
 // Advanced filtering for ItemActionAll()
 struct IMGUI_API ImGuiTestActionFilter
 {
@@ -222,6 +230,7 @@ struct IMGUI_API ImGuiTestContext
     bool                    FirstGuiFrame = false;
     bool                    HasDock = false;                        // #ifdef IMGUI_HAS_DOCK expressed in an easier to test value
     ImGuiCaptureArgs*       CaptureArgs = NULL;                     // Capture settings used by ctx->Capture*() functions
+    int                     CaptureComparesQueued = 0;              // Number of ctx->CaptureCompare() calls in current test
 
     //-------------------------------------------------------------------------
     // [Internal Fields]
@@ -232,13 +241,18 @@ struct IMGUI_API ImGuiTestContext
     ImGuiTestGatherTask*    GatherTask = NULL;
     ImGuiTestRunFlags       RunFlags = ImGuiTestRunFlags_None;
     ImGuiTestActiveFunc     ActiveFunc = ImGuiTestActiveFunc_None;  // None/GuiFunc/TestFunc
-    double                  RunningTime = 0.0;                      // Amount of wall clock time the Test has been running. Used by safety watchdog.
+    double                  RunningTime = 0.0;                      // Amount of time the Test has been running, from the point of view of Dear ImGui context (sum of io.DeltaTime). Used by safety watchdog.
+    double                  RunningTimeReal = 0.0;                  // Amount of wall clock time the Test has been running. Used by safety watchdog.
+    ImU64                   RunStartTime = 0;                       // Wall clock time when this run started. Each step of a stress sweep is a run, while ImGuiTest::StartTime is set by first step.
     int                     ActionDepth = 0;                        // Nested depth of ctx-> function calls (used to decorate log)
     int                     CaptureCounter = 0;                     // Number of captures
     int                     ErrorCounter = 0;                       // Number of errors (generally this maxxes at 1 as most functions will early out)
     bool                    Abort = false;
     double                  PerfRefDt = -1.0;
     int                     PerfIterations = 400;                   // Number of frames for PerfCapture() measurements
+    int                     MicroBenchIterations = 1000;            // Number of back-to-back kernel calls per timed batch for MicroBench()
+    int                     MicroBenchBatches = 200;                // Number of timed batches for MicroBench() (multiplied by PerfStressAmount)
+    int                     MicroBenchWarmupBatches = 20;           // Number of untimed batches run before measuring for MicroBench()
     char                    RefStr[256] = { 0 };                    // Reference window/path for ID construction
     ImGuiID                 RefID = 0;
     ImGuiID                 RefWindowID = 0;                        // ID of a window that contains RefID item
@@ -246,7 +260,9 @@ struct IMGUI_API ImGuiTestContext
     ImVector<char>          Clipboard;                              // Private clipboard for the test instance
     ImVector<ImGuiWindow*>  ForeignWindowsToHide;
     ImGuiTestItemInfo       DummyItemInfoNull;                      // Storage for ItemInfoNull()
+    bool                    InputBurst = false;                     // Set between BeginInputBurst() and EndInputBurst()
     bool                    CachedLinesPrintedToTTY = false;
+    ImGuiTextBuffer         LogLineBuffer;                          // Scratch buffer for formatting log lines printed to TTY/debugger
 
     //-------------------------------------------------------------------------
     // Public API
@@ -286,7 +302,7 @@ struct IMGUI_API ImGuiTestContext
     void        Sleep(float time_in_second);            // Sleep for a given simulation time, unless in Fast mode
     void        SleepShort();                           // Standard short delay of io.ActionDelayShort (~0.15f), unless in Fast mode.
     void        SleepStandard();                        // Standard regular delay of io.ActionDelayStandard (~0.40f), unless in Fast mode.
-    void        SleepNoSkip(float time_in_second, float framestep_in_second);
+    void        SleepNoSkip(float time_in_second, float framestep_in_second, ImGuiTestSleepPolicy policy = ImGuiTestSleepPolicy_Step); // Sleep for a given simulation time, even in Fast mode
 
     // Base Reference
     // - ItemClick("Window/Button")                --> click "Window/Button"
@@ -332,6 +348,7 @@ struct IMGUI_API ImGuiTestContext
     bool        CaptureAddWindow(ImGuiTestRef ref);                                 // Add window to be captured (default to capture everything)
     void        CaptureScreenshotWindow(ImGuiTestRef ref, int capture_flags = 0);   // Trigger a screen capture of a single window (== CaptureAddWindow() + CaptureScreenshot())
     bool        CaptureScreenshot(int capture_flags = 0);                           // Trigger a screen capture
+    bool        CaptureCompare(const char* name, int capture_flags = 0);            // Trigger a screen capture and compare it with golden image "<io.CaptureGoldensDir>/<name>.png". Tolerance etc. are set in CaptureArgs->InCompare. Failure is reported by end of test.
     bool        CaptureBeginVideo();                                                // Start a video capture
     bool        CaptureEndVideo();
 
@@ -371,6 +388,15 @@ struct IMGUI_API ImGuiTestContext
     void        KeyCharsReplace(const char* chars);         // Delete existing field then input characters
     void        KeyCharsReplaceEnter(const char* chars);    // Delete existing field then input characters, press Enter
 
+    // Input bursts (only honored with ImGuiTestRunSpeed_Fast, otherwise functions below behave as usual)
+    // - Between BeginInputBurst() and EndInputBurst(), KeyDown/KeyUp/KeyPress/KeyChars/MouseDown/MouseUp/MouseClick/MouseClickMulti only queue their events and don't yield.
+    // - EndInputBurst() submits the whole sequence to Dear ImGui input queue and yields until it has been consumed.
+    //   With io.ConfigInputTrickleEventQueue (default) Dear ImGui still spreads transitions so each frame sees at most one transition per key/button.
+    // - Mouse position is not part of the burst: move the mouse before beginning it. Consecutive clicks on a same button may be seen as double-clicks.
+    void        BeginInputBurst();
+    void        EndInputBurst();
+    bool        IsInputBurst() const        { return InputBurst && EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Fast; }
+
     // Navigation inputs
     // FIXME: Need some redesign/refactoring:
     // - This was initially intended to: replace mouse action with keyboard/gamepad
@@ -425,9 +451,9 @@ struct IMGUI_API ImGuiTestContext
     void        ItemInputValue(ImGuiTestRef ref, const char* str);
 
     // Item/Widgets: Drag and Mouse operations
-    void        ItemHold(ImGuiTestRef ref, float time);
+    void        ItemHold(ImGuiTestRef ref, float time);                             // Step every frame (e.g. repeating buttons). Skipped to a single frame in Fast mode.
     void        ItemHoldForFrames(ImGuiTestRef ref, int frames);
-    void        ItemDragOverAndHold(ImGuiTestRef ref_src, ImGuiTestRef ref_dst);
+    void        ItemDragOverAndHold(ImGuiTestRef ref_src, ImGuiTestRef ref_dst);   // Hold 1 second over destination, jumping over most of it (see ImGuiTestSleepPolicy_Jump).
     void        ItemDragAndDrop(ImGuiTestRef ref_src, ImGuiTestRef ref_dst, ImGuiMouseButton button = 0);
     void        ItemDragWithDelta(ImGuiTestRef ref_src, ImVec2 pos_delta);
 
@@ -483,6 +509,8 @@ struct IMGUI_API ImGuiTestContext
     // Performances
     void        PerfCalcRef();
     void        PerfCapture(const char* category = NULL, const char* test_name = NULL, const char* csv_file = NULL);
+    void        PerfCaptureValue(const char* category, const char* test_name, double value_ms, const char* csv_file = NULL); // Record a value measured by the test (e.g. latency of an operation). Names must be persistent (e.g. literals).
+    void        MicroBench(const char* test_name, ImFuncPtr(ImGuiTestMicroBenchFunc) func, ImFuncPtr(ImGuiTestMicroBenchFunc) reset_func = NULL, void* user_data = NULL); // Time 'func' in a tight loop within current frame. Records "<test_name>_ns_op" (nanoseconds per call). 'reset_func' is called between batches, outside of timing.
 
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -45,6 +45,7 @@ Index of this file:
 // [SECTION] HOOKS FOR CORE LIBRARY
 // [SECTION] CHECK/ERROR FUNCTIONS FOR TESTS
 // [SECTION] SETTINGS
+// [SECTION] ImGuiTestItemList
 // [SECTION] ImGuiTestLog
 // [SECTION] ImGuiTest
 
@@ -76,6 +77,8 @@ static void ImGuiTestEngine_PostRender(ImGuiTestEngine* engine, ImGuiContext* ui
 static void ImGuiTestEngine_UpdateHooks(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_RunGuiFunc(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* ctx);
+static void ImGuiTestEngine_ProcessCaptureWriterResults(ImGuiTestEngine* engine);
+static void ImGuiTestEngine_RestoreVideoCaptureSettings(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_TestQueueCoroutineMain(void* engine_opaque);
 
 // Settings
@@ -114,6 +117,7 @@ ImGuiTestEngine::ImGuiTestEngine()
     PerfTool = IM_NEW(ImGuiPerfTool);
     UiFilterTests = IM_NEW(Str256); // We bite the bullet of adding an extra alloc/indirection in order to avoid including Str.h in our header
     UiFilterPerfs = IM_NEW(Str256);
+    UiFilterMicroBenchs = IM_NEW(Str256);
 
     // Initialize std::thread based coroutine implementation if requested
 #if IMGUI_TEST_ENGINE_ENABLE_COROUTINE_STDTHREAD_IMPL
@@ -125,9 +129,13 @@ ImGuiTestEngine::ImGuiTestEngine()
 ImGuiTestEngine::~ImGuiTestEngine()
 {
     IM_ASSERT(TestQueueCoroutine == NULL);
+    ImGuiTestEngine_ExportStreamEnd(this);
     IM_DELETE(PerfTool);
     IM_DELETE(UiFilterTests);
     IM_DELETE(UiFilterPerfs);
+    IM_DELETE(UiFilterMicroBenchs);
+    for (char* name : PerfNamesPool)
+        IM_FREE(name);
 }
 
 static void ImGuiTestEngine_BindImGuiContext(ImGuiTestEngine* engine, ImGuiContext* ui_ctx)
@@ -271,6 +279,9 @@ void    ImGuiTestEngine_Stop(ImGuiTestEngine* engine)
 
     engine->Abort = true;
     ImGuiTestEngine_CoroutineStopAndJoin(engine);
+    engine->CaptureContext.FlushImageWriter();
+    ImGuiTestEngine_ProcessCaptureWriterResults(engine);
+    ImGuiTestEngine_ExportStreamEnd(engine);
     ImGuiTestEngine_Export(engine);
     engine->Started = false;
 }
@@ -328,7 +339,7 @@ void    ImGuiTestEngine_RebootUiContext(ImGuiTestEngine* engine)
     ctx->FontAtlasOwnedByContext = false;
 #if 1
     ImGui::DestroyContext();
-    ImGui::CreateContext(backup_atlas);
+    ctx = ImGui::CreateContext(backup_atlas);
 #else
     // Preserve same context pointer, which is probably misleading and not even necessary.
     ImGui::Shutdown(ctx);
@@ -340,6 +351,9 @@ void    ImGuiTestEngine_RebootUiContext(ImGuiTestEngine* engine)
     // Restore
     ctx->FontAtlasOwnedByContext = backup_atlas_owned_by_context;
     ctx->IO = backup_io;
+#if IMGUI_VERSION_NUM >= 19000
+    ctx->IO.Ctx = ctx;
+#endif
 #ifdef IMGUI_HAS_VIEWPORT
     //backup_platform_io.Viewports.swap(ctx->PlatformIO.Viewports);
     //ctx->PlatformIO = backup_platform_io;
@@ -369,20 +383,81 @@ void    ImGuiTestEngine_PostSwap(ImGuiTestEngine* engine)
     engine->CaptureContext.VideoCaptureEncoderParamsSize = IM_ARRAYSIZE(engine->IO.VideoCaptureEncoderParams);
     engine->CaptureContext.GifCaptureEncoderParams = engine->IO.GifCaptureEncoderParams;
     engine->CaptureContext.GifCaptureEncoderParamsSize = IM_ARRAYSIZE(engine->IO.GifCaptureEncoderParams);
+    engine->CaptureContext.ImageWriterThreads = engine->IO.ConfigCaptureWriterThreads;
+    engine->CaptureContext.VideoBackpressure = engine->IO.VideoCaptureBackpressure;
+    engine->CaptureContext.VideoDuplicateFrames = engine->IO.VideoCaptureDuplicateFrames;
+    engine->CaptureContext.PngCompressionLevel = engine->IO.ImageCapturePngCompressionLevel;
+    engine->CaptureContext.PngFilter = engine->IO.ImageCapturePngFilter;
     engine->CaptureTool.VideoCaptureExtension = engine->IO.VideoCaptureExtension;
     engine->CaptureTool.VideoCaptureExtensionSize = IM_ARRAYSIZE(engine->IO.VideoCaptureExtension);
 
     // Capture a screenshot from main thread while coroutine waits
     if (engine->CaptureCurrentArgs != NULL)
     {
+        const bool was_capturing_video = engine->CaptureContext.IsCapturingVideo();
         ImGuiCaptureStatus status = engine->CaptureContext.CaptureUpdate(engine->CaptureCurrentArgs);
         if (status != ImGuiCaptureStatus_InProgress)
         {
             if (status == ImGuiCaptureStatus_Done)
                 ImStrncpy(engine->CaptureTool.OutputLastFilename, engine->CaptureCurrentArgs->InOutputFile, IM_ARRAYSIZE(engine->CaptureTool.OutputLastFilename));
+            if (was_capturing_video && !engine->CaptureContext.IsCapturingVideo())
+                ImGuiTestEngine_RestoreVideoCaptureSettings(engine); // Video ended by an error (e.g. capture size changed)
             engine->CaptureCurrentArgs = NULL;
         }
     }
+    ImGuiTestEngine_ProcessCaptureWriterResults(engine);
+}
+
+static void ImGuiTestEngine_LogToTest(ImGuiTestEngine* engine, ImGuiTest* test, ImGuiTestVerboseLevel level, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    if (engine->TestContext != NULL && engine->TestContext->Test == test)
+        engine->TestContext->LogExV(level, ImGuiTestLogFlags_None, fmt, args);
+    else if (level <= engine->IO.ConfigVerboseLevelOnError)
+        test->TestLog.AddLineV(level, ImGuiTestLogFlags_NoHeader, 0, 0, fmt, args); // Test is not running anymore
+    va_end(args);
+}
+
+// Report images written (and golden image comparisons done) in background by the capture context into the log of the test which captured them.
+static void ImGuiTestEngine_ProcessCaptureWriterResults(ImGuiTestEngine* engine)
+{
+    ImGuiCaptureCompareResult compare;
+    while (engine->CaptureContext.PollCompareResult(&compare))
+    {
+        ImGuiTest* test = (ImGuiTest*)compare.UserData;
+        if (test == NULL || !engine->TestsAll.contains(test))
+            continue;
+        if (compare.GoldenMissing)
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Error, "Missing golden image '%s'", compare.GoldenFile);
+        else if (compare.SizeMismatch)
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Error, "Capture size %dx%d doesn't match golden image '%s' (%dx%d)", (int)compare.ImageSize.x, (int)compare.ImageSize.y, compare.GoldenFile, (int)compare.GoldenSize.x, (int)compare.GoldenSize.y);
+        else if (!compare.Success)
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Error, "Capture differs from golden image '%s': %d pixels different (%d anti-aliased, %d ignored), max channel diff %d, in (%.0f,%.0f)-(%.0f,%.0f)", compare.GoldenFile, compare.PixelsDifferent, compare.PixelsAntiAliased, compare.PixelsIgnored, compare.MaxChannelDiff, compare.DiffRect.Min.x, compare.DiffRect.Min.y, compare.DiffRect.Max.x, compare.DiffRect.Max.y);
+        else
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Debug, "Capture matches golden image '%s' (%d pixels different, %d anti-aliased, %d ignored) in %.1f ms", compare.GoldenFile, compare.PixelsDifferent, compare.PixelsAntiAliased, compare.PixelsIgnored, compare.DurationMs);
+        if (compare.DiffFile[0] != 0)
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Error, "Wrote diff image '%s'", compare.DiffFile);
+        if (!compare.Success && engine->TestContext != NULL && engine->TestContext->Test == test)
+            ImGuiTestEngine_Check(NULL, NULL, 0, ImGuiTestCheckFlags_None, false, "CaptureCompare()");
+    }
+
+
+    ImGuiCaptureImageWriterResult result;
+    while (engine->CaptureContext.PollImageWriterResult(&result))
+    {
+        ImGuiTest* test = (ImGuiTest*)result.UserData;
+        if (test == NULL || !engine->TestsAll.contains(test))
+        {
+            if (!result.Success)
+                fprintf(stderr, "Failed to write '%s'\n", result.Filename);
+            continue;
+        }
+        if (result.Success)
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Debug, "Wrote '%s' in %.1f ms", result.Filename, result.DurationMs);
+        else
+            ImGuiTestEngine_LogToTest(engine, test, ImGuiTestVerboseLevel_Error, "Failed to write '%s'", result.Filename);
+    }
 }
 
 ImGuiTestEngineIO&  ImGuiTestEngine_GetIO(ImGuiTestEngine* engine)
@@ -495,6 +570,16 @@ bool ImGuiTestEngine_IsUsingSimulatedInputs(ImGuiTestEngine* engine)
     return false;
 }
 
+// Virtual clock is not used by perf tests and micro-benchmarks, which are measuring real time.
+bool ImGuiTestEngine_IsUsingVirtualClock(ImGuiTestEngine* engine)
+{
+    if (!engine->IO.ConfigVirtualClock || engine->TestContext == NULL)
+        return false;
+    if (engine->TestContext->Test->Group == ImGuiTestGroup_Perfs || engine->TestContext->Test->Group == ImGuiTestGroup_MicroBenchs)
+        return false;
+    return ImGuiTestEngine_IsUsingSimulatedInputs(engine);
+}
+
 // Setup inputs in the tested Dear ImGui context. Essentially we override the work of the backend here.
 void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
 {
@@ -539,9 +624,16 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
 #endif
 
     // Apply mouse
+    // (buttons with transitions queued by an input burst are submitted in order with the rest of the queue)
+    int mouse_buttons_queued_mask = 0x00;
+    for (const ImGuiTestInput& input : engine->Inputs.Queue)
+        if (input.Type == ImGuiTestInputType_MouseButton)
+            mouse_buttons_queued_mask |= (1 << input.MouseButton);
     io.AddMousePosEvent(engine->Inputs.MousePosValue.x, engine->Inputs.MousePosValue.y);
     for (int n = 0; n < ImGuiMouseButton_COUNT; n++)
     {
+        if (mouse_buttons_queued_mask & (1 << n))
+            continue;
         bool down = (engine->Inputs.MouseButtonsValue & (1 << n)) != 0;
         io.AddMouseButtonEvent(n, down);
 
@@ -571,7 +663,7 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
     {
         for (int n = 0; n < engine->Inputs.Queue.Size; n++)
         {
-            const ImGuiTestInput& input = engine->Inputs.Queue[n];
+            const ImGuiTestInput input = engine->Inputs.Queue[n]; // Copy as processing may append to the queue
             switch (input.Type)
             {
             case ImGuiTestInputType_Key:
@@ -604,6 +696,19 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
                 io.AddInputCharacter(input.Char);
                 break;
             }
+            case ImGuiTestInputType_MouseButton:
+            {
+                io.AddMouseButtonEvent(input.MouseButton, input.Down);
+#ifdef IMGUI_HAS_VIEWPORT
+                if (input.Down && mouse_hovered_viewport && !mouse_hovered_viewport_focused)
+                    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+                    {
+                        mouse_hovered_viewport_focused = true;
+                        engine->Inputs.Queue.push_back(ImGuiTestInput::ForViewportFocus(mouse_hovered_viewport->ID));
+                    }
+#endif
+                break;
+            }
             case ImGuiTestInputType_ViewportFocus:
             {
 #ifdef IMGUI_HAS_VIEWPORT
@@ -693,15 +798,23 @@ static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* u
         ui_ctx->IO.DeltaTime = engine->OverrideDeltaTime;
         engine->OverrideDeltaTime = -1.0f;
     }
+    else if (ImGuiTestEngine_IsUsingVirtualClock(engine))
+    {
+        ui_ctx->IO.DeltaTime = 1.0f / 60.0f; // Default virtual frame duration when ConfigFixedDeltaTime is not set
+    }
 
     // NewFrame() will increase this so we are +1 ahead at the time of calling this
     engine->FrameCount = g.FrameCount + 1;
     if (ImGuiTestContext* test_ctx = engine->TestContext)
     {
-        double t0 = test_ctx->RunningTime;
-        double t1 = t0 + ui_ctx->IO.DeltaTime;
+        // Watchdog counts both Dear ImGui time (which may be virtual) and wall clock time, whichever is highest.
+        double t0 = ImMax(test_ctx->RunningTime, test_ctx->RunningTimeReal);
         test_ctx->FrameCount++;
-        test_ctx->RunningTime = t1;
+        test_ctx->RunningTime += ui_ctx->IO.DeltaTime;
+        test_ctx->Test->FrameCount++;
+        test_ctx->Test->SimulatedTime += ui_ctx->IO.DeltaTime;
+        test_ctx->RunningTimeReal = (double)(ImTimeGetInMicroseconds() - test_ctx->RunStartTime) / 1000000.0;
+        double t1 = ImMax(test_ctx->RunningTime, test_ctx->RunningTimeReal);
         ImGuiTestEngine_UpdateWatchdog(engine, ui_ctx, t0, t1);
     }
 
@@ -784,6 +897,8 @@ static void ImGuiTestEngine_PostNewFrame(ImGuiTestEngine* engine, ImGuiContext*
 
     // Disable vsync
     engine->IO.IsRequestingMaxAppSpeed = engine->IO.ConfigNoThrottle;
+    if (ImGuiTestEngine_IsUsingVirtualClock(engine))
+        engine->IO.IsRequestingMaxAppSpeed = true;
     if (engine->IO.ConfigRunSpeed == ImGuiTestRunSpeed_Fast && engine->IO.IsRunningTests)
         if (engine->TestContext && (engine->TestContext->RunFlags & ImGuiTestRunFlags_GuiFuncOnly) == 0)
             engine->IO.IsRequestingMaxAppSpeed = true;
@@ -863,6 +978,7 @@ void ImGuiTestEngine_Yield(ImGuiTestEngine* engine)
     if (ctx)
     {
         IM_ASSERT(ctx->ActiveFunc == ImGuiTestActiveFunc_TestFunc && "Can only yield inside TestFunc()!");
+        ctx->Test->YieldCount++;
         for (ImGuiWindow* window : ctx->ForeignWindowsToHide)
         {
             window->HiddenFramesForRenderOnly = 2;          // Hide root window
@@ -925,6 +1041,10 @@ bool ImGuiTestEngine_CaptureScreenshot(ImGuiTestEngine* engine, ImGuiCaptureArgs
     if ((args->InFlags & ImGuiCaptureFlags_Instant) == 0)
         ImGuiTestEngine_Yield(engine);
 
+    // Attribute image file written in background to current test
+    if (engine->TestContext != NULL)
+        args->InUserData = engine->TestContext->Test;
+
     // This will yield until ImGuiTestEngine_PostSwap() -> ImGuiCaptureContext::CaptureUpdate() return false.
     // - CaptureUpdate() will call user provided test_io.ScreenCaptureFunc() function
     // - Capturing is likely to take multiple frames depending on settings.
@@ -968,11 +1088,20 @@ bool ImGuiTestEngine_CaptureBeginVideo(ImGuiTestEngine* engine, ImGuiCaptureArgs
         engine->IO.ConfigNoThrottle = true;
         engine->IO.ConfigFixedDeltaTime = 1.0f / 60.0f;
     }
+    if (engine->TestContext != NULL)
+        args->InUserData = engine->TestContext->Test;
     engine->CaptureCurrentArgs = args;
     engine->CaptureContext.BeginVideoCapture(args);
     return true;
 }
 
+static void ImGuiTestEngine_RestoreVideoCaptureSettings(ImGuiTestEngine* engine)
+{
+    engine->IO.ConfigRunSpeed = engine->BackupConfigRunSpeed;
+    engine->IO.ConfigNoThrottle = engine->BackupConfigNoThrottle;
+    engine->IO.ConfigFixedDeltaTime = 0;
+}
+
 bool ImGuiTestEngine_CaptureEndVideo(ImGuiTestEngine* engine, ImGuiCaptureArgs* args)
 {
     IM_UNUSED(args);
@@ -981,9 +1110,7 @@ bool ImGuiTestEngine_CaptureEndVideo(ImGuiTestEngine* engine, ImGuiCaptureArgs*
     engine->CaptureContext.EndVideoCapture();
     while (engine->CaptureCurrentArgs != NULL)   // Wait until last frame is captured and gif is saved.
         ImGuiTestEngine_Yield(engine);
-    engine->IO.ConfigRunSpeed = engine->BackupConfigRunSpeed;
-    engine->IO.ConfigNoThrottle = engine->BackupConfigNoThrottle;
-    engine->IO.ConfigFixedDeltaTime = 0;
+    ImGuiTestEngine_RestoreVideoCaptureSettings(engine);
     engine->CaptureCurrentArgs = NULL;
     return true;
 }
@@ -997,19 +1124,47 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
     io.IniFilename = NULL;
 
     engine->BatchStartTime = ImTimeGetInMicroseconds();
+    ImGuiTestEngine_ExportStreamBegin(engine);
     int ran_tests = 0;
     engine->IO.IsRunningTests = true;
     for (int n = 0; n < engine->TestsQueue.Size; n++)
     {
         ImGuiTestRunTask* run_task = &engine->TestsQueue[n];
         ImGuiTest* test = run_task->Test;
+
+        // Stress sweep: same test is queued consecutively once per stress amount (see io.PerfStressSweepMax).
+        // Statistics and PerfCaptures[] accumulate over the sweep, results are exported once after the last step.
+        const bool is_sweep_continuation = (n > 0 && engine->TestsQueue[n - 1].Test == test);
+        const bool is_sweep_last = (n + 1 == engine->TestsQueue.Size || engine->TestsQueue[n + 1].Test != test);
+        if (is_sweep_continuation)
+        {
+            if (test->Status != ImGuiTestStatus_Success)
+            {
+                // Stop sweeping a test after an error
+                if (is_sweep_last)
+                    ImGuiTestEngine_ExportStreamTest(engine, test);
+                continue;
+            }
+            test->Status = ImGuiTestStatus_Queued;
+        }
+
         IM_ASSERT(test->Status == ImGuiTestStatus_Queued);
-        test->StartTime = ImTimeGetInMicroseconds();
+        const ImU64 run_start_time = ImTimeGetInMicroseconds();
+        if (!is_sweep_continuation)
+        {
+            test->StartTime = run_start_time;
+            test->FrameCount = test->YieldCount = 0;
+            test->SimulatedTime = 0.0;
+            test->PerfCaptures.resize(0);
+        }
 
         if (engine->Abort)
         {
             test->Status = ImGuiTestStatus_Unknown;
-            test->EndTime = test->StartTime;
+            if (!is_sweep_continuation)
+                test->EndTime = test->StartTime;
+            if (is_sweep_last)
+                ImGuiTestEngine_ExportStreamTest(engine, test);
             continue;
         }
 
@@ -1029,7 +1184,8 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
         ctx.GatherTask = &engine->GatherTask;
         ctx.UserVars = NULL;
         ctx.UiContext = engine->UiContextActive;
-        ctx.PerfStressAmount = engine->IO.PerfStressAmount;
+        ctx.RunStartTime = run_start_time;
+        ctx.PerfStressAmount = (run_task->PerfStressAmount > 0) ? run_task->PerfStressAmount : engine->IO.PerfStressAmount;
         ctx.RunFlags = run_task->RunFlags;
 #ifdef IMGUI_HAS_DOCK
         ctx.HasDock = true;
@@ -1071,6 +1227,8 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
         }
         ran_tests++;
         test->EndTime = ImTimeGetInMicroseconds();
+        if (is_sweep_last)
+            ImGuiTestEngine_ExportStreamTest(engine, test);
 
         IM_ASSERT(engine->TestContext == &ctx);
         IM_ASSERT(engine->UiContextActive == engine->UiContextTarget);
@@ -1085,6 +1243,7 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
     }
     engine->IO.IsRunningTests = false;
     engine->BatchEndTime = ImTimeGetInMicroseconds();
+    ImGuiTestEngine_ExportStreamEnd(engine);
 
     engine->Abort = false;
     engine->TestsQueue.clear();
@@ -1129,6 +1288,20 @@ void ImGuiTestEngine_QueueTest(ImGuiTestEngine* engine, ImGuiTest* test, ImGuiTe
     ImGuiTestRunTask run_task;
     run_task.Test = test;
     run_task.RunFlags = run_flags;
+
+    // Scaling curve mode: queue one run per stress amount (1, 2, 4... io.PerfStressSweepMax)
+    const int sweep_max = engine->IO.PerfStressSweepMax;
+    if (test->Group == ImGuiTestGroup_Perfs && sweep_max > 1)
+    {
+        for (int stress_amount = 1; ; stress_amount = ImMin(stress_amount * 2, sweep_max))
+        {
+            run_task.PerfStressAmount = stress_amount;
+            engine->TestsQueue.push_back(run_task);
+            if (stress_amount == sweep_max)
+                break;
+        }
+        return;
+    }
     engine->TestsQueue.push_back(run_task);
 }
 
@@ -1138,6 +1311,8 @@ ImGuiTest* ImGuiTestEngine_RegisterTest(ImGuiTestEngine* engine, const char* cat
     ImGuiTestGroup group = ImGuiTestGroup_Tests;
     if (strcmp(category, "perf") == 0)
         group = ImGuiTestGroup_Perfs;
+    else if (strcmp(category, "microbench") == 0)
+        group = ImGuiTestGroup_MicroBenchs;
 
     ImGuiTest* t = IM_NEW(ImGuiTest)();
     t->Group = group;
@@ -1164,6 +1339,7 @@ ImGuiPerfTool* ImGuiTestEngine_GetPerfTool(ImGuiTestEngine* engine)
 // - "all"   : all tests, no matter what group they are in.
 // - "tests" : tests in ImGuiTestGroup_Tests group.
 // - "perfs" : tests in ImGuiTestGroup_Perfs group.
+// - "microbenchs" : tests in ImGuiTestGroup_MicroBenchs group.
 // Example queries:
 // - ""      : empty query matches no tests.
 // - "^nav_" : all tests with name starting with "nav_".
@@ -1230,6 +1406,8 @@ bool ImGuiTestEngine_PassFilter(ImGuiTest* test, const char* filter_specs)
             include = (test->Group == ImGuiTestGroup_Tests) ? !is_exclude : include;
         else if (str_iequal("perfs", filter_start, filter_end))
             include = (test->Group == ImGuiTestGroup_Perfs) ? !is_exclude : include;
+        else if (str_iequal("microbenchs", filter_start, filter_end))
+            include = (test->Group == ImGuiTestGroup_MicroBenchs) ? !is_exclude : include;
         else
         {
             // General filtering
@@ -1347,6 +1525,7 @@ static void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* c
     ImGuiTest* test = ctx->Test;
     ctx->FrameCount = 0;
     ctx->ErrorCounter = 0;
+    ctx->CaptureComparesQueued = 0;
     ctx->SetRef("");
     ctx->SetInputMode(ImGuiInputSource_Mouse);
     ctx->UiContext->NavInputSource = ImGuiInputSource_Keyboard;
@@ -1448,6 +1627,13 @@ static void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* c
                     ctx->Yield();
         }
 
+        // Wait for pending golden image comparisons, so their failures are reported on this test.
+        if (ctx->CaptureComparesQueued > 0)
+        {
+            engine->CaptureContext.FlushImageWriter();
+            ImGuiTestEngine_ProcessCaptureWriterResults(engine);
+        }
+
         // Capture failure screenshot.
         if (ctx->IsError() && engine->IO.ConfigCaptureOnError)
         {
@@ -1456,7 +1642,7 @@ static void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* c
             args.InFlags = ImGuiCaptureFlags_Instant;
             args.InCaptureRect.Min = ImGui::GetMainViewport()->Pos;
             args.InCaptureRect.Max = args.InCaptureRect.Min + ImGui::GetMainViewport()->Size;
-            ImFormatString(args.InOutputFile, IM_ARRAYSIZE(args.InOutputFile), "output/failures/%s_%04d.png", ctx->Test->Name, ctx->ErrorCounter);
+            ImFormatString(args.InOutputFile, IM_ARRAYSIZE(args.InOutputFile), "output/failures/%s_%04d%s", ctx->Test->Name, ctx->ErrorCounter, engine->IO.ImageCaptureExtension);
             if (ImGuiTestEngine_CaptureScreenshot(engine, &args))
                 ctx->LogDebug("Saved '%s' (%d*%d pixels)", args.InOutputFile, (int)args.OutImageSize.x, (int)args.OutImageSize.y);
         }
@@ -1532,6 +1718,10 @@ static void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* c
     ctx->UiContext->DebugLogFlags = backup_debug_log_flags;
     ctx->UiContext->ConfigNavWindowingKeyNext = backup_nav_windowing_key_next;
     ctx->UiContext->ConfigNavWindowingKeyPrev = backup_nav_windowing_key_prev;
+
+    // Bound memory used by logs of tests which succeeded
+    if (test->Status == ImGuiTestStatus_Success && engine->IO.ConfigLogMaxLinesOnSuccess > 0)
+        test->TestLog.TrimToLastLines(engine->IO.ConfigLogMaxLinesOnSuccess);
 }
 
 //-------------------------------------------------------------------------
@@ -1560,11 +1750,13 @@ void ImGuiTestEngine_CrashHandler()
         {
             test->Status = ImGuiTestStatus_Error;
             test->EndTime = engine->BatchEndTime;
+            ImGuiTestEngine_ExportStreamTest(engine, test);
             break;
         }
     }
 
     // Export test run results.
+    ImGuiTestEngine_ExportStreamEnd(engine);
     ImGuiTestEngine_Export(engine);
 }
 
@@ -1663,19 +1855,22 @@ static void ImGuiTestEngineHook_ItemAdd_GatherTask(ImGuiContext* ui_ctx, ImGuiTe
 
     if (result_depth != -1)
     {
-        ImGuiTestItemInfo* item = task->OutList->Pool.GetOrAddByKey(id); // Add
-        item->TimestampMain = engine->FrameCount;
-        item->ID = id;
-        item->ParentID = parent_id;
-        item->Window = window;
-        item->RectFull = item->RectClipped = bb;
-        item->RectClipped.ClipWithFull(window->ClipRect);      // This two step clipping is important, we want RectClipped to stays within RectFull
-        item->RectClipped.ClipWithFull(item->RectFull);
-        item->NavLayer = window->DC.NavLayerCurrent;
-        item->Depth = result_depth;
-        item->InFlags = item_data ? item_data->InFlags : ImGuiItemFlags_None;
-        item->StatusFlags = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
-        task->LastItemInfo = item;
+        ImGuiTestItemList* list = task->OutList;
+        const int n = list->GetOrAddIndexByID(id); // Add
+        ImRect rect_clipped = bb;
+        rect_clipped.ClipWithFull(window->ClipRect);    // This two step clipping is important, we want RectClipped to stays within RectFull
+        rect_clipped.ClipWithFull(bb);
+        list->TimestampsMain[n] = engine->FrameCount;
+        list->ParentIDs[n] = parent_id;
+        list->Windows[n] = window;
+        list->RectsFull[n] = bb;
+        list->RectsClipped[n] = rect_clipped;
+        list->NavLayers[n] = (ImU8)window->DC.NavLayerCurrent;
+        list->Depths[n] = (ImS16)result_depth;
+        list->InFlags[n] = item_data ? item_data->InFlags : ImGuiItemFlags_None;
+        list->StatusFlags[n] = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
+        list->DepthMax = ImMax(list->DepthMax, result_depth);
+        task->LastItemID = id;
     }
 }
 
@@ -1822,13 +2017,14 @@ void ImGuiTestEngineHook_ItemInfo(ImGuiContext* ui_ctx, ImGuiID id, const char*
     }
 
     // Update Gather Task status flags
-    if (engine->GatherTask.LastItemInfo && engine->GatherTask.LastItemInfo->ID == id)
+    if (engine->GatherTask.LastItemID != 0 && engine->GatherTask.LastItemID == id)
     {
-        ImGuiTestItemInfo* item = engine->GatherTask.LastItemInfo;
-        item->TimestampStatus = g.FrameCount;
-        item->StatusFlags = flags;
+        ImGuiTestItemList* list = engine->GatherTask.OutList;
+        const int n = list->GetIndexByID(id);
+        list->TimestampsStatus[n] = g.FrameCount;
+        list->StatusFlags[n] = flags;
         if (label)
-            ImStrncpy(item->DebugLabel, label, IM_ARRAYSIZE(item->DebugLabel));
+            list->SetLabel(n, label);
     }
 
     // Update Find by Label Task
@@ -2043,6 +2239,7 @@ static void     ImGuiTestEngine_SettingsReadLine(ImGuiContext* ui_ctx, ImGuiSett
     int n = 0;
     /**/ if (SettingsTryReadString(line, "FilterTests=", e->UiFilterTests))                                                         { }
     else if (SettingsTryReadString(line, "FilterPerfs=", e->UiFilterPerfs))                                                         { }
+    else if (SettingsTryReadString(line, "FilterMicroBenchs=", e->UiFilterMicroBenchs))                                             { }
     else if (sscanf(line, "LogHeight=%f", &e->UiLogHeight) == 1)                                                                    { }
     else if (sscanf(line, "CaptureTool=%d", &n) == 1)                                                                               { e->UiCaptureToolOpen = (n != 0); }
     else if (sscanf(line, "PerfTool=%d", &n) == 1)                                                                                  { e->UiPerfToolOpen = (n != 0); }
@@ -2053,6 +2250,9 @@ static void     ImGuiTestEngine_SettingsReadLine(ImGuiContext* ui_ctx, ImGuiSett
     else if (SettingsTryReadString(line, "VideoCaptureParamsToEncoder=", e->IO.VideoCaptureEncoderParams, IM_ARRAYSIZE(e->IO.VideoCaptureEncoderParams))) { }
     else if (SettingsTryReadString(line, "GifCaptureParamsToEncoder=", e->IO.GifCaptureEncoderParams, IM_ARRAYSIZE(e->IO.GifCaptureEncoderParams))) { }
     else if (SettingsTryReadString(line, "VideoCaptureExtension=", e->IO.VideoCaptureExtension, IM_ARRAYSIZE(e->IO.VideoCaptureExtension))) { }
+    else if (SettingsTryReadString(line, "ImageCaptureExtension=", e->IO.ImageCaptureExtension, IM_ARRAYSIZE(e->IO.ImageCaptureExtension))) { }
+    else if (sscanf(line, "ImageCapturePngCompressionLevel=%d", &n) == 1)                                                           { e->IO.ImageCapturePngCompressionLevel = n; }
+    else if (sscanf(line, "ImageCapturePngFilter=%d", &n) == 1)                                                                     { e->IO.ImageCapturePngFilter = n; }
 }
 
 static void     ImGuiTestEngine_SettingsWriteAll(ImGuiContext* ui_ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
@@ -2064,6 +2264,7 @@ static void     ImGuiTestEngine_SettingsWriteAll(ImGuiContext* ui_ctx, ImGuiSett
     buf->appendf("[%s][Data]\n", handler->TypeName);
     buf->appendf("FilterTests=%s\n", engine->UiFilterTests->c_str());
     buf->appendf("FilterPerfs=%s\n", engine->UiFilterPerfs->c_str());
+    buf->appendf("FilterMicroBenchs=%s\n", engine->UiFilterMicroBenchs->c_str());
     buf->appendf("LogHeight=%.0f\n", engine->UiLogHeight);
     buf->appendf("CaptureTool=%d\n", engine->UiCaptureToolOpen);
     buf->appendf("PerfTool=%d\n", engine->UiPerfToolOpen);
@@ -2074,18 +2275,442 @@ static void     ImGuiTestEngine_SettingsWriteAll(ImGuiContext* ui_ctx, ImGuiSett
     buf->appendf("VideoCaptureParamsToEncoder=%s\n", engine->IO.VideoCaptureEncoderParams);
     buf->appendf("GifCaptureParamsToEncoder=%s\n", engine->IO.GifCaptureEncoderParams);
     buf->appendf("VideoCaptureExtension=%s\n", engine->IO.VideoCaptureExtension);
+    buf->appendf("ImageCaptureExtension=%s\n", engine->IO.ImageCaptureExtension);
+    buf->appendf("ImageCapturePngCompressionLevel=%d\n", engine->IO.ImageCapturePngCompressionLevel);
+    buf->appendf("ImageCapturePngFilter=%d\n", engine->IO.ImageCapturePngFilter);
     buf->appendf("\n");
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] ImGuiTestItemList
+//-------------------------------------------------------------------------
+
+void ImGuiTestItemList::Clear()
+{
+    IDs.clear();
+    ParentIDs.clear();
+    Windows.clear();
+    StatusFlags.clear();
+    InFlags.clear();
+    Depths.clear();
+    NavLayers.clear();
+    RectsFull.clear();
+    RectsClipped.clear();
+    TimestampsMain.clear();
+    TimestampsStatus.clear();
+    LabelOffsets.clear();
+    LabelCapacities.clear();
+    LabelsBuf.clear();
+    Map.Clear();
+    DepthMax = -1;
+}
+
+void ImGuiTestItemList::Reserve(int capacity)
+{
+    IDs.reserve(capacity);
+    ParentIDs.reserve(capacity);
+    Windows.reserve(capacity);
+    StatusFlags.reserve(capacity);
+    InFlags.reserve(capacity);
+    Depths.reserve(capacity);
+    NavLayers.reserve(capacity);
+    RectsFull.reserve(capacity);
+    RectsClipped.reserve(capacity);
+    TimestampsMain.reserve(capacity);
+    TimestampsStatus.reserve(capacity);
+    LabelOffsets.reserve(capacity);
+    LabelCapacities.reserve(capacity);
+    Map.Data.reserve(capacity);
+}
+
+int ImGuiTestItemList::GetOrAddIndexByID(ImGuiID id)
+{
+    int n = Map.GetInt(id, -1);
+    if (n != -1)
+        return n;
+    n = IDs.Size;
+    Map.SetInt(id, n);
+    IDs.push_back(id);
+    ParentIDs.push_back(0);
+    Windows.push_back(NULL);
+    StatusFlags.push_back(ImGuiItemStatusFlags_None);
+    InFlags.push_back(ImGuiItemFlags_None);
+    Depths.push_back(0);
+    NavLayers.push_back(0);
+    RectsFull.push_back(ImRect());
+    RectsClipped.push_back(ImRect());
+    TimestampsMain.push_back(-1);
+    TimestampsStatus.push_back(-1);
+    LabelOffsets.push_back(-1);
+    LabelCapacities.push_back(0);
+    return n;
+}
+
+// The ItemInfo() hook is called every frame while gathering, so we don't want to grow LabelsBuf each time:
+// a label is written over its previous slot when it fits. When it doesn't, a slot of maximum label size is appended,
+// so each item wastes at most one slot whatever its label changes are.
+void ImGuiTestItemList::SetLabel(int n, const char* label)
+{
+    const int label_len_max = IM_ARRAYSIZE(ImGuiTestItemInfo::DebugLabel) - 1;
+    const int label_len = ImMin((int)strlen(label), label_len_max);
+    if (LabelOffsets[n] < 0 || label_len > LabelCapacities[n])
+    {
+        const int capacity = (LabelOffsets[n] < 0) ? label_len : label_len_max;
+        LabelOffsets[n] = LabelsBuf.Size;
+        LabelCapacities[n] = (ImU8)capacity;
+        LabelsBuf.resize(LabelsBuf.Size + capacity + 1);
+    }
+    char* stored_label = &LabelsBuf[LabelOffsets[n]];
+    memcpy(stored_label, label, (size_t)label_len);
+    stored_label[label_len] = 0;
+}
+
+void ImGuiTestItemList::GetItemInfo(int n, ImGuiTestItemInfo* out_info) const
+{
+    IM_ASSERT(n >= 0 && n < IDs.Size);
+    *out_info = ImGuiTestItemInfo();
+    out_info->NavLayer = NavLayers[n];
+    out_info->Depth = Depths[n];
+    out_info->TimestampMain = TimestampsMain[n];
+    out_info->TimestampStatus = TimestampsStatus[n];
+    out_info->ID = IDs[n];
+    out_info->ParentID = ParentIDs[n];
+    out_info->Window = Windows[n];
+    out_info->RectFull = RectsFull[n];
+    out_info->RectClipped = RectsClipped[n];
+    out_info->InFlags = InFlags[n];
+    out_info->StatusFlags = StatusFlags[n];
+    ImStrncpy(out_info->DebugLabel, GetLabel(n), IM_ARRAYSIZE(out_info->DebugLabel));
+}
+
+// Shared implementation for Filter*() functions.
+// Writing index k only after reading index k makes it safe for 'out_indices' to alias 'in_indices'.
+template<typename PREDICATE>
+static int ImGuiTestItemList_Filter(const ImGuiTestItemList* list, ImVector<int>* out_indices, const ImVector<int>* in_indices, PREDICATE pred)
+{
+    IM_ASSERT(out_indices != NULL);
+    int out_count = 0;
+    if (in_indices == NULL)
+    {
+        out_indices->resize(list->GetSize());
+        int* out_data = out_indices->Data;
+        for (int n = 0; n < list->GetSize(); n++)
+        {
+            out_data[out_count] = n;
+            out_count += pred(n) ? 1 : 0;   // Branchless compaction
+        }
+    }
+    else
+    {
+        const int in_count = in_indices->Size;
+        if (out_indices != in_indices)
+            out_indices->resize(in_count);
+        const int* in_data = in_indices->Data;
+        int* out_data = out_indices->Data;
+        for (int i = 0; i < in_count; i++)
+        {
+            const int n = in_data[i];
+            out_data[out_count] = n;
+            out_count += pred(n) ? 1 : 0;
+        }
+    }
+    out_indices->resize(out_count);
+    return out_count;
+}
+
+int ImGuiTestItemList::FilterByStatusFlags(ImVector<int>* out_indices, ImGuiItemStatusFlags require_all, ImGuiItemStatusFlags require_any, const ImVector<int>* in_indices) const
+{
+    const ImGuiItemStatusFlags* flags = StatusFlags.Data;
+    return ImGuiTestItemList_Filter(this, out_indices, in_indices, [=](int n) { return (flags[n] & require_all) == require_all && (require_any == 0 || (flags[n] & require_any) != 0); });
+}
+
+int ImGuiTestItemList::FilterByDepth(ImVector<int>* out_indices, int depth_min, int depth_max, const ImVector<int>* in_indices) const
+{
+    const ImS16* depths = Depths.Data;
+    return ImGuiTestItemList_Filter(this, out_indices, in_indices, [=](int n) { return depths[n] >= depth_min && depths[n] <= depth_max; });
+}
+
+int ImGuiTestItemList::FilterByWindow(ImVector<int>* out_indices, ImGuiWindow* window, const ImVector<int>* in_indices) const
+{
+    ImGuiWindow* const* windows = Windows.Data;
+    return ImGuiTestItemList_Filter(this, out_indices, in_indices, [=](int n) { return windows[n] == window; });
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImGuiTestLog
 //-------------------------------------------------------------------------
 
+// A record is a ImGuiTestLogRecord header followed by its printf arguments, packed in 8-bytes slots:
+// - integers are widened to 64-bits, floating point values to double, pointers to 64-bits.
+// - strings are stored as their length followed by a zero-terminated copy, padded to 8-bytes.
+// - '*' width and precision values are stored as integers before the value they apply to.
+struct ImGuiTestLogRecord
+{
+    const char*     Fmt;
+    int             FrameCount;
+    ImS16           Depth;          // Indentation of Debug/Trace lines
+    ImU8            Level;          // ImGuiTestVerboseLevel
+    ImU8            Flags;          // ImGuiTestLogFlags
+    int             ArgsSize;       // Size of packed arguments following this header
+    int             RecordSize;     // Total size of record including header and padding
+};
+
+// Record flag stored along ImGuiTestLogFlags: record is a single "%s" argument already including header and indentation.
+static const int ImGuiTestLogRecordFlags_Preformatted = 1 << 7;
+
+struct ImGuiTestLogFmtSpec
+{
+    const char*     Begin;          // Points to '%'
+    const char*     LengthBegin;    // Points to length modifier, if any, otherwise to conversion
+    const char*     End;
+    char            Length;         // 0, 'H' (hh), 'h', 'l', 'q' (ll), 'j', 'z', 't', 'D' (L)
+    char            Conv;
+    bool            StarWidth;
+    bool            StarPrecision;
+    int             Precision;      // -1 when none or '*'
+};
+
+static const char* ImGuiTestLog_ParseFmtSpec(const char* p, ImGuiTestLogFmtSpec* spec)
+{
+    IM_ASSERT(*p == '%');
+    spec->Begin = p++;
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' || *p == '\'')
+        p++;
+    spec->StarWidth = (*p == '*');
+    if (spec->StarWidth)
+        p++;
+    while (*p >= '0' && *p <= '9')
+        p++;
+    spec->StarPrecision = false;
+    spec->Precision = -1;
+    if (*p == '.')
+    {
+        p++;
+        spec->StarPrecision = (*p == '*');
+        if (spec->StarPrecision)
+            p++;
+        else
+            for (spec->Precision = 0; *p >= '0' && *p <= '9'; p++)
+                spec->Precision = spec->Precision * 10 + (*p - '0');
+    }
+    spec->LengthBegin = p;
+    spec->Length = 0;
+    if (p[0] == 'h' && p[1] == 'h')         { spec->Length = 'H'; p += 2; }
+    else if (p[0] == 'l' && p[1] == 'l')    { spec->Length = 'q'; p += 2; }
+    else if (p[0] == 'L')                   { spec->Length = 'D'; p += 1; }
+    else if (p[0] == 'h' || p[0] == 'l' || p[0] == 'j' || p[0] == 'z' || p[0] == 't') { spec->Length = p[0]; p += 1; }
+    spec->Conv = *p;
+    if (*p)
+        p++;
+    spec->End = p;
+    return p;
+}
+
+static void ImGuiTestLog_PackSlot(ImVector<char>* out, const void* data, int size)
+{
+    const int offset = out->Size;
+    out->resize(offset + ((size + 7) & ~7));
+    memcpy(out->Data + offset, data, (size_t)size);
+}
+
+static void ImGuiTestLog_PackInt(ImVector<char>* out, ImS64 v)  { ImGuiTestLog_PackSlot(out, &v, sizeof(v)); }
+static ImS64 ImGuiTestLog_ReadInt(const char** p)               { ImS64 v; memcpy(&v, *p, sizeof(v)); *p += 8; return v; }
+
+static void ImGuiTestLog_PackString(ImVector<char>* out, const char* str, ImS64 len)
+{
+    ImGuiTestLog_PackInt(out, len);
+    if (len < 0)
+        return;
+    const int offset = out->Size;
+    out->resize(offset + (((int)len + 1 + 7) & ~7));
+    memcpy(out->Data + offset, str, (size_t)len);
+    out->Data[offset + len] = 0;
+}
+
+// Return true if any string argument contains a '\n'.
+static bool ImGuiTestLog_PackArgs(ImVector<char>* out, const char* fmt, va_list args)
+{
+    bool has_new_line = false;
+    for (const char* p = fmt; (p = strchr(p, '%')) != NULL; )
+    {
+        ImGuiTestLogFmtSpec spec;
+        p = ImGuiTestLog_ParseFmtSpec(p, &spec);
+        if (spec.StarWidth)
+            ImGuiTestLog_PackInt(out, va_arg(args, int));
+        if (spec.StarPrecision)
+        {
+            spec.Precision = va_arg(args, int);
+            ImGuiTestLog_PackInt(out, spec.Precision);
+        }
+        switch (spec.Conv)
+        {
+        case 'd': case 'i':
+        {
+            ImS64 v;
+            switch (spec.Length)
+            {
+            case 'H': v = (signed char)va_arg(args, int); break;
+            case 'h': v = (short)va_arg(args, int); break;
+            case 'l': v = va_arg(args, long); break;
+            case 'q': v = va_arg(args, long long); break;
+            case 'j': v = (ImS64)va_arg(args, intmax_t); break;
+            case 'z': case 't': v = (ImS64)va_arg(args, ptrdiff_t); break;
+            default:  v = va_arg(args, int); break;
+            }
+            ImGuiTestLog_PackInt(out, v);
+            break;
+        }
+        case 'u': case 'x': case 'X': case 'o':
+        {
+            ImU64 v;
+            switch (spec.Length)
+            {
+            case 'H': v = (unsigned char)va_arg(args, unsigned int); break;
+            case 'h': v = (unsigned short)va_arg(args, unsigned int); break;
+            case 'l': v = va_arg(args, unsigned long); break;
+            case 'q': v = va_arg(args, unsigned long long); break;
+            case 'j': v = (ImU64)va_arg(args, uintmax_t); break;
+            case 'z': case 't': v = (ImU64)va_arg(args, size_t); break;
+            default:  v = va_arg(args, unsigned int); break;
+            }
+            ImGuiTestLog_PackInt(out, (ImS64)v);
+            break;
+        }
+        case 'c':
+            IM_ASSERT(spec.Length == 0 && "Wide characters are not supported.");
+            ImGuiTestLog_PackInt(out, va_arg(args, int));
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        {
+            double v = (spec.Length == 'D') ? (double)va_arg(args, long double) : va_arg(args, double);
+            ImGuiTestLog_PackSlot(out, &v, sizeof(v));
+            break;
+        }
+        case 'p':
+            ImGuiTestLog_PackInt(out, (ImS64)(intptr_t)va_arg(args, void*));
+            break;
+        case 's':
+        {
+            IM_ASSERT(spec.Length == 0 && "Wide strings are not supported.");
+            const char* str = va_arg(args, const char*);
+            ImS64 len = -1;
+            if (str != NULL)
+            {
+                // Honor precision: "%.*s" is commonly used on strings which are not zero-terminated.
+                const char* str_end = (spec.Precision >= 0) ? (const char*)memchr(str, 0, (size_t)spec.Precision) : NULL;
+                len = (spec.Precision >= 0) ? (str_end ? str_end - str : spec.Precision) : (ImS64)strlen(str);
+                if (memchr(str, '\n', (size_t)len) != NULL)
+                    has_new_line = true;
+            }
+            ImGuiTestLog_PackString(out, str, len);
+            break;
+        }
+        case 'n':
+            (void)va_arg(args, int*); // Not supported
+            break;
+        case '%':
+            break;
+        default:
+            IM_ASSERT(0 && "Unsupported format specifier.");
+            break;
+        }
+    }
+    return has_new_line;
+}
+
+// Replay printf arguments packed by ImGuiTestLog_PackArgs() using format string stored in record.
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wformat-nonliteral"  // warning: format string is not a string literal
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"    // warning: format not a string literal, format string not checked
+#endif
+static void ImGuiTestLog_FormatArgs(ImGuiTextBuffer* out, const char* fmt, const char* args)
+{
+    for (const char* p = fmt; *p != 0; )
+    {
+        const char* p_spec = strchr(p, '%');
+        if (p_spec == NULL)
+        {
+            out->append(p);
+            break;
+        }
+        out->append(p, p_spec);
+
+        // Rebuild specifier with '*' resolved and our own length modifier, e.g. "%-*zu" -> "%-12llu"
+        ImGuiTestLogFmtSpec spec;
+        p = ImGuiTestLog_ParseFmtSpec(p_spec, &spec);
+        char spec_buf[32];
+        int spec_len = 0;
+        for (const char* s = spec.Begin; s < spec.LengthBegin && spec_len < IM_ARRAYSIZE(spec_buf) - 16; s++)
+        {
+            if (*s == '*')
+                spec_len += ImFormatString(spec_buf + spec_len, IM_ARRAYSIZE(spec_buf) - spec_len, "%d", (int)ImGuiTestLog_ReadInt(&args));
+            else
+                spec_buf[spec_len++] = *s;
+        }
+        switch (spec.Conv)
+        {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o':
+            ImFormatString(spec_buf + spec_len, IM_ARRAYSIZE(spec_buf) - spec_len, "ll%c", spec.Conv);
+            if (spec.Conv == 'd' || spec.Conv == 'i')
+                out->appendf(spec_buf, (long long)ImGuiTestLog_ReadInt(&args));
+            else
+                out->appendf(spec_buf, (unsigned long long)ImGuiTestLog_ReadInt(&args));
+            break;
+        case 'c':
+        case 'p':
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        {
+            spec_buf[spec_len++] = spec.Conv;
+            spec_buf[spec_len] = 0;
+            ImS64 v = ImGuiTestLog_ReadInt(&args);
+            if (spec.Conv == 'c')
+                out->appendf(spec_buf, (int)v);
+            else if (spec.Conv == 'p')
+                out->appendf(spec_buf, (void*)(intptr_t)v);
+            else
+            {
+                double d;
+                memcpy(&d, &v, sizeof(d));
+                out->appendf(spec_buf, d);
+            }
+            break;
+        }
+        case 's':
+        {
+            spec_buf[spec_len++] = 's';
+            spec_buf[spec_len] = 0;
+            ImS64 len = ImGuiTestLog_ReadInt(&args);
+            out->appendf(spec_buf, (len >= 0) ? args : "(null)");
+            if (len >= 0)
+                args += ((int)len + 1 + 7) & ~7;
+            break;
+        }
+        case '%':
+            out->append("%");
+            break;
+        case 'n':
+            break;
+        default:
+            out->append(spec.Begin, spec.End);
+            break;
+        }
+    }
+}
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 void ImGuiTestLog::Clear()
 {
-    Buffer.clear();
-    LineInfo.clear();
+    Records.resize(0);
+    LineInfo.resize(0);
     memset(&CountPerLevel, 0, sizeof(CountPerLevel));
+    LinesTrimmed = 0;
 }
 
 // Output:
@@ -2110,38 +2735,97 @@ int ImGuiTestLog::ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel level_min,
     }
 
     // Extract lines and return count
-    for (auto& line_info : LineInfo)
-        if (line_info.Level >= level_min && line_info.Level <= level_max)
+    for (int line_no = 0; line_no < LineInfo.Size; line_no++)
+        if (LineInfo[line_no].Level >= level_min && LineInfo[line_no].Level <= level_max)
         {
-            const char* line_begin = Buffer.c_str() + line_info.LineOffset;
-            const char* line_end = strchr(line_begin, '\n');
-            out_buffer->append(line_begin, line_end[0] == '\n' ? line_end + 1 : line_end);
+            FormatLine(line_no, out_buffer);
             count++;
         }
     return count;
 }
 
-void ImGuiTestLog::UpdateLineOffsets(ImGuiTestEngineIO* engine_io, ImGuiTestVerboseLevel level, const char* start)
-{
-    IM_UNUSED(engine_io);
-    IM_ASSERT(Buffer.begin() <= start && start < Buffer.end());
-    const char* p_begin = start;
-    const char* p_end = Buffer.end();
-    const char* p = p_begin;
-    while (p < p_end)
+void ImGuiTestLog::FormatLine(int line_no, ImGuiTextBuffer* out_buffer) const
+{
+    const ImGuiTestLogRecord* record = (const ImGuiTestLogRecord*)(const void*)(Records.Data + LineInfo[line_no].LineOffset);
+    const int out_start = out_buffer->size();
+    const bool preformatted = (record->Flags & ImGuiTestLogRecordFlags_Preformatted) != 0;
+    if ((record->Flags & ImGuiTestLogFlags_NoHeader) == 0 && !preformatted)
+        out_buffer->appendf("[%04d] ", record->FrameCount);
+    if (record->Level >= ImGuiTestVerboseLevel_Debug && !preformatted)
+        out_buffer->appendf("-- %*s", record->Depth * 2, "");
+    ImGuiTestLog_FormatArgs(out_buffer, record->Fmt, (const char*)(record + 1));
+    if (out_buffer->size() == out_start || out_buffer->end()[-1] != '\n')
+        out_buffer->append("\n");
+}
+
+static void ImGuiTestLog_FinishRecord(ImGuiTestLog* log, int offset, ImGuiTestVerboseLevel level, int flags, int frame_count, int depth, const char* fmt)
+{
+    ImGuiTestLogRecord* record = (ImGuiTestLogRecord*)(void*)(log->Records.Data + offset);
+    record->Fmt = fmt;
+    record->FrameCount = frame_count;
+    record->Depth = (ImS16)ImMax(0, depth - 1);
+    record->Level = (ImU8)level;
+    record->Flags = (ImU8)flags;
+    record->RecordSize = log->Records.Size - offset;
+    record->ArgsSize = record->RecordSize - (int)sizeof(ImGuiTestLogRecord);
+
+    log->LineInfo.push_back({ level, offset });
+    log->CountPerLevel[level] += 1;
+}
+
+// Return index of first line added. A message containing '\n' (e.g. multi-line check output) is formatted right away
+// and split into one record per line, so every consumer may rely on one record being one line.
+int ImGuiTestLog::AddLineV(ImGuiTestVerboseLevel level, ImGuiTestLogFlags flags, int frame_count, int depth, const char* fmt, va_list args)
+{
+    IM_ASSERT(level > ImGuiTestVerboseLevel_Silent && level < ImGuiTestVerboseLevel_COUNT);
+    const int offset = Records.Size;
+    Records.resize(offset + (int)sizeof(ImGuiTestLogRecord));
+    const bool has_new_line = ImGuiTestLog_PackArgs(&Records, fmt, args) || strchr(fmt, '\n') != NULL;
+    ImGuiTestLog_FinishRecord(this, offset, level, flags, frame_count, depth, fmt);
+    const int line_no = LineInfo.Size - 1;
+    if (!has_new_line)
+        return line_no;
+
+    // Split into lines. Only first line has a header, like when lines were stored as text.
+    ImGuiTextBuffer text;
+    FormatLine(line_no, &text);
+    Records.resize(offset);
+    LineInfo.pop_back();
+    CountPerLevel[level] -= 1;
+    for (const char* line = text.begin(); line < text.end(); )
     {
-        const char* p_bol = p;
-        const char* p_eol = strchr(p, '\n');
-
-        bool last_empty_line = (p_bol + 1 == p_end);
-        if (!last_empty_line)
-        {
-            int offset = (int)(p_bol - Buffer.c_str());
-            LineInfo.push_back({level, offset});
-            CountPerLevel[level] += 1;
-        }
-        p = p_eol ? p_eol + 1 : NULL;
+        const char* line_end = (const char*)memchr(line, '\n', (size_t)(text.end() - line));
+        const int line_offset = Records.Size;
+        Records.resize(line_offset + (int)sizeof(ImGuiTestLogRecord));
+        ImGuiTestLog_PackString(&Records, line, line_end - line);
+        ImGuiTestLog_FinishRecord(this, line_offset, level, flags | ImGuiTestLogRecordFlags_Preformatted, frame_count, depth, "%s");
+        line = line_end + 1;
     }
+    return line_no;
+}
+
+void ImGuiTestLog::TrimToLastLines(int max_lines)
+{
+    if (max_lines <= 0 || LineInfo.Size <= max_lines)
+        return;
+
+    // Compact records of last lines to the beginning of arena
+    const int trim_count = LineInfo.Size - max_lines;
+    const int trim_offset = LineInfo[trim_count].LineOffset;
+    for (int line_no = 0; line_no < trim_count; line_no++)
+        CountPerLevel[LineInfo[line_no].Level] -= 1;
+    memmove(Records.Data, Records.Data + trim_offset, (size_t)(Records.Size - trim_offset));
+    Records.resize(Records.Size - trim_offset);
+    LineInfo.erase(LineInfo.Data, LineInfo.Data + trim_count);
+    for (ImGuiTestLogLineInfo& line_info : LineInfo)
+        line_info.LineOffset -= trim_offset;
+    LinesTrimmed += trim_count;
+
+    // Release unused memory
+    ImVector<char> records = Records;
+    Records.swap(records);
+    ImVector<ImGuiTestLogLineInfo> line_info = LineInfo;
+    LineInfo.swap(line_info);
 }
 
 //-------------------------------------------------------------------------
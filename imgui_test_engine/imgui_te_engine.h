@@ -83,6 +83,7 @@ enum ImGuiTestGroup : int
     ImGuiTestGroup_Unknown      = -1,
     ImGuiTestGroup_Tests        = 0,
     ImGuiTestGroup_Perfs        = 1,
+    ImGuiTestGroup_MicroBenchs  = 2,    // Micro-benchmarks, registered in "microbench" category (see ImGuiTestContext::MicroBench())
     ImGuiTestGroup_COUNT
 };
 
@@ -155,6 +156,7 @@ IMGUI_API ImGuiTestEngine*    ImGuiTestEngine_CreateContext();
 IMGUI_API void                ImGuiTestEngine_DestroyContext(ImGuiTestEngine* engine);              // Destroy test engine. Call after ImGui::DestroyContext() so test engine specific ini data gets saved.
 IMGUI_API void                ImGuiTestEngine_Start(ImGuiTestEngine* engine, ImGuiContext* ui_ctx); // Bind to a dear imgui context. Start coroutine.
 IMGUI_API void                ImGuiTestEngine_Stop(ImGuiTestEngine* engine);                        // Stop coroutine and export if any. (Unbind will lazily happen on context shutdown)
+IMGUI_API void                ImGuiTestEngine_RebootUiContext(ImGuiTestEngine* engine);             // [EXPERIMENTAL] Destroy and recreate bound dear imgui context, preserving its IO and font atlas. Context pointer changes.
 IMGUI_API void                ImGuiTestEngine_PostSwap(ImGuiTestEngine* engine);                    // Call every frame after framebuffer swap, will process screen capture and call test_io.ScreenCaptureFunc()
 IMGUI_API ImGuiTestEngineIO&  ImGuiTestEngine_GetIO(ImGuiTestEngine* engine);
 
@@ -172,6 +174,7 @@ IMGUI_API void                ImGuiTestEngine_AbortCurrentTest(ImGuiTestEngine*
 // FIXME: Clarify API to avoid function calls vs raw bools in ImGuiTestEngineIO
 IMGUI_API bool                ImGuiTestEngine_IsTestQueueEmpty(ImGuiTestEngine* engine);
 IMGUI_API bool                ImGuiTestEngine_IsUsingSimulatedInputs(ImGuiTestEngine* engine);
+IMGUI_API bool                ImGuiTestEngine_IsUsingVirtualClock(ImGuiTestEngine* engine);
 IMGUI_API void                ImGuiTestEngine_GetResult(ImGuiTestEngine* engine, int& count_tested, int& success_count);
 
 // Functions: Crash Handling
@@ -211,13 +214,17 @@ struct IMGUI_API ImGuiTestEngineIO
     ImGuiTestVerboseLevel       ConfigVerboseLevelOnError = ImGuiTestVerboseLevel_Info;
     bool                        ConfigLogToTTY = false;
     bool                        ConfigLogToDebugger = false;
+    int                         ConfigLogMaxLinesOnSuccess = 0;     // When > 0, the log of a test which succeeded is trimmed down to its last N lines. Bounds memory usage of large test batches.
     bool                        ConfigTakeFocusBackAfterTests = true;
     bool                        ConfigCaptureEnabled = true;        // Master enable flags for capturing and saving captures. Disable to avoid e.g. lengthy saving of large PNG files.
     bool                        ConfigCaptureOnError = false;
+    int                         ConfigCaptureWriterThreads = 0;     // Number of background threads encoding and writing captured images (0: write synchronously). Pending files are written on ImGuiTestEngine_Stop().
     bool                        ConfigNoThrottle = false;           // Disable vsync for performance measurement or fast test running
     bool                        ConfigMouseDrawCursor = true;       // Enable drawing of Dear ImGui software mouse cursor when running tests
     float                       ConfigFixedDeltaTime = 0.0f;        // Use fixed delta time instead of calculating it from wall clock
+    bool                        ConfigVirtualClock = false;         // Engine owns simulated time while running tests (except perf tests): io.DeltaTime is ConfigFixedDeltaTime (or 1/60) and never follows wall clock, throttling is disabled. Watchdogs count both virtual and wall clock time.
     int                         PerfStressAmount = 1;               // Integer to scale the amount of items submitted in test
+    int                         PerfStressSweepMax = 0;             // When > 1: run each queued perf test at stress amounts 1, 2, 4... up to this value, to measure scaling curves (see ImGuiPerfTool::CalcScalingFits())
     char                        GitBranchName[64] = "";             // e.g. fill in branch name (e.g. recorded in perf samples .csv)
 
     // Options: Speed of user simulation
@@ -233,6 +240,13 @@ struct IMGUI_API ImGuiTestEngineIO
     char                        VideoCaptureEncoderParams[256] = "";// Video encoder parameters for .MP4 captures, e.g. see IMGUI_CAPTURE_DEFAULT_VIDEO_PARAMS_FOR_FFMPEG
     char                        GifCaptureEncoderParams[512] = "";  // Video encoder parameters for .GIF captures, e.g. see IMGUI_CAPTURE_DEFAULT_GIF_PARAMS_FOR_FFMPEG
     char                        VideoCaptureExtension[8] = ".mp4";  // Video file extension (default, may be overridden by test).
+    char                        ImageCaptureExtension[8] = ".png";  // Screenshot file extension (default, may be overridden by test): ".png", or ".qoi" to save faster with larger files.
+    int                         ImageCapturePngCompressionLevel = 8;// PNG zlib compression level (1..9). Lower is faster but produces larger files.
+    int                         ImageCapturePngFilter = -1;         // PNG scanline filter (0..4), -1: try all filters for each scanline (smallest output, slowest).
+    ImGuiCaptureVideoBackpressure VideoCaptureBackpressure = ImGuiCaptureVideoBackpressure_Block; // What to do with recorded frames when video encoder falls behind (block, drop or grow queue)
+    ImGuiCaptureVideoDuplicateFrames VideoCaptureDuplicateFrames = ImGuiCaptureVideoDuplicateFrames_Repeat; // What to do with recorded frames identical to previous frame (encode, repeat or skip)
+    char                        CaptureGoldensDir[256] = "goldens"; // Directory of golden images used by ctx->CaptureCompare().
+    bool                        ConfigCaptureUpdateGoldens = false; // ctx->CaptureCompare() writes captures as new golden images instead of comparing them.
 
     // Options: Watchdog. Set values to FLT_MAX to disable.
     // Interactive GUI applications that may be slower tend to use higher values.
@@ -244,6 +258,9 @@ struct IMGUI_API ImGuiTestEngineIO
     // While you can manually call ImGuiTestEngine_Export(), registering filename/format here ensure the crash handler will always export if application crash.
     const char*                 ExportResultsFilename = NULL;
     ImGuiTestEngineExportFormat ExportResultsFormat = (ImGuiTestEngineExportFormat)0;
+    const char*                 ExportResultsStreamFilename = NULL; // Append one record per test as soon as it completes. See imgui_te_exporters.h.
+    ImGuiTestEngineExportFormat ExportResultsStreamFormat = (ImGuiTestEngineExportFormat)0; // ImGuiTestEngineExportFormat_JsonLines or _JUnitXml (<testcase> fragments).
+    float                       ExportResultsStreamSyncInterval = 5.0f; // Minimum time between syncing stream file to disk (fsync), in seconds. 0.0f: after every test.
 
     //-------------------------------------------------------------------------
     // Output
@@ -281,43 +298,86 @@ struct ImGuiTestItemInfo
 };
 
 // Result of an GatherItems() query
+// Stored as a structure-of-arrays: every column is indexed by the same item index, in order of discovery.
+// - Hot loops (filtering by status flags, depth, window) only touch the columns they need.
+// - Filter*() functions output a span of item indices and never copy or reorder items. Pass a previous output as 'in_indices' to chain filters.
+// - ImGuiTestItemInfo structures (including DebugLabel) are only materialized on demand, e.g. by GetByIndex() or range-for.
 struct IMGUI_API ImGuiTestItemList
 {
-    ImPool<ImGuiTestItemInfo>   Pool;
-
-    void                        Clear()                 { Pool.Clear(); }
-    void                        Reserve(int capacity)   { Pool.Reserve(capacity); }
-    int                         GetSize() const         { return Pool.GetMapSize(); }
-    const ImGuiTestItemInfo*    GetByIndex(int n)       { return Pool.GetByIndex(n); }
-    const ImGuiTestItemInfo*    GetByID(ImGuiID id)     { return Pool.GetByKey(id); }
-
-    // For range-for
-    size_t                      size() const            { return (size_t)Pool.GetMapSize(); }
-    const ImGuiTestItemInfo*    begin() const           { return Pool.Buf.begin(); }
-    const ImGuiTestItemInfo*    end() const             { return Pool.Buf.end(); }
-    const ImGuiTestItemInfo*    operator[] (size_t n)   { return &Pool.Buf[(int)n]; }
+    ImVector<ImGuiID>               IDs;
+    ImVector<ImGuiID>               ParentIDs;
+    ImVector<ImGuiWindow*>          Windows;
+    ImVector<ImGuiItemStatusFlags>  StatusFlags;
+    ImVector<ImGuiItemFlags>        InFlags;
+    ImVector<ImS16>                 Depths;
+    ImVector<ImU8>                  NavLayers;
+    ImVector<ImRect>                RectsFull;
+    ImVector<ImRect>                RectsClipped;
+    ImVector<int>                   TimestampsMain;
+    ImVector<int>                   TimestampsStatus;
+    ImVector<int>                   LabelOffsets;           // Offset into LabelsBuf, -1 if no label was submitted
+    ImVector<ImU8>                  LabelCapacities;        // Size of slot reserved in LabelsBuf (excluding zero terminator), reused when label changes
+    ImVector<char>                  LabelsBuf;              // Zero-terminated labels, truncated to the size of ImGuiTestItemInfo::DebugLabel
+    ImGuiStorage                    Map;                    // ID -> index
+    int                             DepthMax = -1;          // Highest Depth value stored
+    ImGuiTestItemInfo               _MaterializedInfo;      // Storage for GetByIndex()/GetByID()
+
+    void                        Clear();
+    void                        Reserve(int capacity);
+    int                         GetSize() const         { return IDs.Size; }
+    int                         GetIndexByID(ImGuiID id) const { return Map.GetInt(id, -1); }
+    int                         GetOrAddIndexByID(ImGuiID id);
+    const char*                 GetLabel(int n) const   { return LabelOffsets[n] >= 0 ? &LabelsBuf[LabelOffsets[n]] : ""; }
+    void                        SetLabel(int n, const char* label);
+    void                        GetItemInfo(int n, ImGuiTestItemInfo* out_info) const;
+    const ImGuiTestItemInfo*    GetByIndex(int n)       { GetItemInfo(n, &_MaterializedInfo); return &_MaterializedInfo; } // Pointer is only valid until next call
+    const ImGuiTestItemInfo*    GetByID(ImGuiID id)     { int n = GetIndexByID(id); return n >= 0 ? GetByIndex(n) : NULL; }
+
+    // Filters: output indices of matching items into 'out_indices' (which may be the same vector as 'in_indices')
+    int                         FilterByStatusFlags(ImVector<int>* out_indices, ImGuiItemStatusFlags require_all, ImGuiItemStatusFlags require_any = 0, const ImVector<int>* in_indices = NULL) const;
+    int                         FilterByDepth(ImVector<int>* out_indices, int depth_min, int depth_max, const ImVector<int>* in_indices = NULL) const;
+    int                         FilterByWindow(ImVector<int>* out_indices, ImGuiWindow* window, const ImVector<int>* in_indices = NULL) const;
+
+    // For range-for (materialize each item, prefer accessing columns in hot loops)
+    struct Iterator
+    {
+        const ImGuiTestItemList*    List;
+        int                         Index;
+        ImGuiTestItemInfo           operator*() const       { ImGuiTestItemInfo info; List->GetItemInfo(Index, &info); return info; }
+        Iterator&                   operator++()            { Index++; return *this; }
+        bool                        operator!=(const Iterator& rhs) const { return Index != rhs.Index; }
+    };
+    size_t                      size() const            { return (size_t)IDs.Size; }
+    Iterator                    begin() const           { return Iterator{ this, 0 }; }
+    Iterator                    end() const             { return Iterator{ this, IDs.Size }; }
+    const ImGuiTestItemInfo*    operator[] (size_t n)   { return GetByIndex((int)n); }
 };
 
 //-------------------------------------------------------------------------
 // ImGuiTestLog: store textual output of one given Test.
 //-------------------------------------------------------------------------
+// Lines are stored as binary records (level, frame, depth, format string pointer and packed arguments) in a per-test
+// arena, and only formatted when displayed, exported or printed. The format string is stored by pointer: it needs to
+// be a string literal or otherwise outlive the log. String arguments are copied.
+//-------------------------------------------------------------------------
 
 struct IMGUI_API ImGuiTestLogLineInfo
 {
     ImGuiTestVerboseLevel           Level;
-    int                             LineOffset;
+    int                             LineOffset;         // Offset of record in ImGuiTestLog::Records
 };
 
 struct IMGUI_API ImGuiTestLog
 {
-    ImGuiTextBuffer                 Buffer;
+    ImVector<char>                  Records;            // Arena of binary records (see ImGuiTestLogRecord)
     ImVector<ImGuiTestLogLineInfo>  LineInfo;
     int                             CountPerLevel[ImGuiTestVerboseLevel_COUNT] = {};
+    int                             LinesTrimmed = 0;   // Number of older lines discarded by TrimToLastLines()
 
     // Functions
     ImGuiTestLog() {}
-    bool    IsEmpty() const         { return Buffer.empty(); }
-    void    Clear();
+    bool    IsEmpty() const         { return LineInfo.empty(); }
+    void    Clear();                // Keep arena memory allocated for reuse
 
     // Extract log contents filtered per log-level.
     // Output:
@@ -330,8 +390,12 @@ struct IMGUI_API ImGuiTestLog
     // - To get All Errors, Warnings, Debug...  Use level_min == ImGuiTestVerboseLevel_Error, level_max = ImGuiTestVerboseLevel_Trace
     int     ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel level_min, ImGuiTestVerboseLevel level_max, ImGuiTextBuffer* out_buffer);
 
+    // Format a single line (including its trailing '\n') and append it to 'out_buffer'.
+    void    FormatLine(int line_no, ImGuiTextBuffer* out_buffer) const;
+
     // [Internal]
-    void    UpdateLineOffsets(ImGuiTestEngineIO* engine_io, ImGuiTestVerboseLevel level, const char* start);
+    int     AddLineV(ImGuiTestVerboseLevel level, ImGuiTestLogFlags flags, int frame_count, int depth, const char* fmt, va_list args); // Messages containing '\n' are split into multiple lines. Return index of first line.
+    void    TrimToLastLines(int max_lines);     // Discard older lines and release unused memory (used on tests which succeeded)
 };
 
 //-------------------------------------------------------------------------
@@ -346,13 +410,24 @@ typedef void    (ImGuiTestVarsConstructor)(void* buffer);
 typedef void    (ImGuiTestVarsPostConstructor)(ImGuiTestContext* ctx, void* ptr, void* fn);
 typedef void    (ImGuiTestVarsDestructor)(void* ptr);
 
+// Result of one ImGuiTestContext::PerfCapture() call, kept for result exporters
+struct IMGUI_API ImGuiTestPerfCaptureResult
+{
+    char                            Category[64] = "";
+    char                            TestName[128] = "";
+    double                          DtRefMs = 0.0;                  // Reference frame time (GuiFunc disabled)
+    double                          DtDeltaMs = 0.0;                // Frame time delta over reference
+    int                             PerfStressAmount = 0;
+    int                             PerfIterations = 0;
+};
+
 // Storage for one test
 struct IMGUI_API ImGuiTest
 {
     // Test Definition
     const char*                     Category = NULL;                // Literal, not owned
     const char*                     Name = NULL;                    // Literal, generally not owned unless NameOwned=true
-    ImGuiTestGroup                  Group = ImGuiTestGroup_Unknown; // Coarse groups: 'Tests' or 'Perf'
+    ImGuiTestGroup                  Group = ImGuiTestGroup_Unknown; // Coarse groups: 'Tests', 'Perf' or 'MicroBenchs'
     bool                            NameOwned = false;              //
     const char*                     SourceFile = NULL;              // __FILE__
     int                             SourceLine = 0;                 // __LINE__
@@ -369,6 +444,10 @@ struct IMGUI_API ImGuiTest
     ImU64                           StartTime = 0;
     ImU64                           EndTime = 0;
     int                             GuiFuncLastFrame = -1;
+    int                             FrameCount = 0;                 // Number of frames run (including warm-up frames)
+    int                             YieldCount = 0;                 // Number of ImGuiTestEngine_Yield() calls from TestFunc
+    double                          SimulatedTime = 0.0;            // Sum of io.DeltaTime while running (may be virtual), vs wall clock time in EndTime - StartTime
+    ImVector<ImGuiTestPerfCaptureResult> PerfCaptures;              // Results of PerfCapture() calls
 
     // User variables (which are instantiated when running the test)
     // Setup after test registration with SetVarsDataType<>(), access instance during test with GetVars<>().
@@ -9,12 +9,17 @@
 #include "imgui_te_engine.h"
 #include "imgui_te_internal.h"
 #include "thirdparty/Str/Str.h"
+#include <math.h>       // isfinite()
 
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
 
 static void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_file);
+static void ImGuiTestEngine_ExportJUnitXmlTestCase(ImGuiTestEngine* engine, FILE* fp, ImGuiTest* test, bool with_group);
+static void ImGuiTestEngine_ExportJsonLines(ImGuiTestEngine* engine, const char* output_file);
+static void ImGuiTestEngine_ExportJsonLinesRecord(ImGuiTestEngine* engine, FILE* fp, ImGuiTest* test);
+static void ImGuiTestEngine_ExportJson(ImGuiTestEngine* engine, const char* output_file);
 
 //-------------------------------------------------------------------------
 // [SECTION] TEST ENGINE EXPORTER FUNCTIONS
@@ -23,8 +28,23 @@ static void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char*
 // - ImGuiTestEngine_Export()
 // - ImGuiTestEngine_ExportEx()
 // - ImGuiTestEngine_ExportJUnitXml()
+// - ImGuiTestEngine_ExportJsonLines()
+// - ImGuiTestEngine_ExportJson()
 //-------------------------------------------------------------------------
 
+static const char* ImGuiTestEngine_GetStatusName(ImGuiTestStatus status)
+{
+    static const char* names[] = { "skipped", "success", "queued", "running", "error", "suspended" };
+    const int idx = status + 1; // +1 because _Unknown status is -1.
+    return (idx >= 0 && idx < IM_ARRAYSIZE(names)) ? names[idx] : "N/A";
+}
+
+static const char* ImGuiTestEngine_GetGroupName(ImGuiTestGroup group)
+{
+    static const char* names[ImGuiTestGroup_COUNT] = { "tests", "perfs", "microbenchs" };
+    return (group >= 0 && group < ImGuiTestGroup_COUNT) ? names[group] : "N/A";
+}
+
 void ImGuiTestEngine_PrintResultSummary(ImGuiTestEngine* engine)
 {
     int count_tested = 0;
@@ -95,13 +115,14 @@ static bool ImGuiTestEngine_HasAnyLogLines(ImGuiTestLog* test_log, ImGuiTestVerb
 static void ImGuiTestEngine_PrintLogLines(FILE* fp, ImGuiTestLog* test_log, int indent, ImGuiTestVerboseLevel level)
 {
     Str128 log_line;
-    for (auto& line_info : test_log->LineInfo)
+    ImGuiTextBuffer line_buf;
+    for (int line_no = 0; line_no < test_log->LineInfo.Size; line_no++)
     {
-        if (line_info.Level > level)
+        if (test_log->LineInfo[line_no].Level > level)
             continue;
-        const char* line_start = test_log->Buffer.c_str() + line_info.LineOffset;
-        const char* line_end = strstr(line_start, "\n"); // FIXME: Incorrect.
-        log_line.set(line_start, line_end);
+        line_buf.Buf.resize(0);
+        test_log->FormatLine(line_no, &line_buf);
+        log_line.set(line_buf.begin(), line_buf.end() - 1); // Strip trailing '\n'
         ImStrXmlEscape(&log_line); // FIXME: Should not be here considering the function name.
 
         // Some users may want to disable indenting?
@@ -126,10 +147,78 @@ void ImGuiTestEngine_ExportEx(ImGuiTestEngine* engine, ImGuiTestEngineExportForm
 
     if (format == ImGuiTestEngineExportFormat_JUnitXml)
         ImGuiTestEngine_ExportJUnitXml(engine, filename);
+    else if (format == ImGuiTestEngineExportFormat_JsonLines)
+        ImGuiTestEngine_ExportJsonLines(engine, filename);
+    else if (format == ImGuiTestEngineExportFormat_Json)
+        ImGuiTestEngine_ExportJson(engine, filename);
     else
         IM_ASSERT(0);
 }
 
+// Write <testcase> element. 'with_group' adds a property to find test group back when merging streamed records.
+static void ImGuiTestEngine_ExportJUnitXmlTestCase(ImGuiTestEngine* engine, FILE* fp, ImGuiTest* test, bool with_group)
+{
+    // Attributes for <testcase> tag.
+    const char* testcase_name = test->Name;
+    const char* testcase_classname = test->Category;
+    const char* testcase_status = ImGuiTestEngine_GetStatusName(test->Status);
+    float testcase_time = (float)((double)(test->EndTime - test->StartTime) / 1000000.0);
+
+    fprintf(fp, "    <testcase name=\"%s\" assertions=\"0\" classname=\"%s\" status=\"%s\" time=\"%.3f\">\n",
+        testcase_name, testcase_classname, testcase_status, testcase_time);
+    if (with_group)
+        fprintf(fp, "      <properties><property name=\"group\" value=\"%s\" /></properties>\n", ImGuiTestEngine_GetGroupName(test->Group));
+
+    if (test->Status == ImGuiTestStatus_Error)
+    {
+        // Skip last error message because it is generic information that test failed.
+        Str128 log_line;
+        for (int i = test->TestLog.LineInfo.Size - 2; i >= 0; i--)
+        {
+            ImGuiTestLogLineInfo* line_info = &test->TestLog.LineInfo[i];
+            if (line_info->Level > engine->IO.ConfigVerboseLevelOnError)
+                continue;
+            if (line_info->Level == ImGuiTestVerboseLevel_Error)
+            {
+                ImGuiTextBuffer line_buf;
+                test->TestLog.FormatLine(i, &line_buf);
+                log_line.set(line_buf.begin(), line_buf.end() - 1); // Strip trailing '\n'
+                ImStrXmlEscape(&log_line);
+                break;
+            }
+        }
+
+        // Failing tests save their "on error" log output in text element of <failure> tag.
+        fprintf(fp, "      <failure message=\"%s\" type=\"error\">\n", log_line.c_str());
+        ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, engine->IO.ConfigVerboseLevelOnError);
+        fprintf(fp, "      </failure>\n");
+    }
+
+    if (test->Status == ImGuiTestStatus_Unknown)
+    {
+        fprintf(fp, "      <skipped message=\"Skipped\" />\n");
+    }
+    else
+    {
+        // Succeeding tests save their defaiult log output output as "stdout".
+        if (ImGuiTestEngine_HasAnyLogLines(&test->TestLog, engine->IO.ConfigVerboseLevel))
+        {
+            fprintf(fp, "      <system-out>\n");
+            ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, engine->IO.ConfigVerboseLevel);
+            fprintf(fp, "      </system-out>\n");
+        }
+
+        // Save error messages as "stderr".
+        if (ImGuiTestEngine_HasAnyLogLines(&test->TestLog, ImGuiTestVerboseLevel_Error))
+        {
+            fprintf(fp, "      <system-err>\n");
+            ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, ImGuiTestVerboseLevel_Error);
+            fprintf(fp, "      </system-err>\n");
+        }
+    }
+    fprintf(fp, "    </testcase>\n");
+}
+
 void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_file)
 {
     IM_ASSERT(engine != NULL);
@@ -150,8 +239,9 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
         int         Failures = 0;
         int         Disabled = 0;
     } testsuites[ImGuiTestGroup_COUNT];
-    testsuites[ImGuiTestGroup_Tests].Name = "tests";
-    testsuites[ImGuiTestGroup_Perfs].Name = "perfs";
+    testsuites[ImGuiTestGroup_Tests].Name = ImGuiTestEngine_GetGroupName(ImGuiTestGroup_Tests);
+    testsuites[ImGuiTestGroup_Perfs].Name = ImGuiTestEngine_GetGroupName(ImGuiTestGroup_Perfs);
+    testsuites[ImGuiTestGroup_MicroBenchs].Name = ImGuiTestEngine_GetGroupName(ImGuiTestGroup_MicroBenchs);
 
     for (int n = 0; n < engine->TestsAll.Size; n++)
     {
@@ -182,7 +272,6 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
         "<testsuites disabled=\"%d\" errors=\"0\" failures=\"%d\" name=\"%s\" tests=\"%d\" time=\"%.3f\">\n",
         testsuites_disabled, testsuites_failures, testsuites_name, testsuites_tests, testsuites_time);
 
-    const char* teststatus_names[] = { "skipped", "success", "queued", "running", "error", "suspended" };
     for (int testsuite_id = ImGuiTestGroup_Tests; testsuite_id < ImGuiTestGroup_COUNT; testsuite_id++)
     {
         // Attributes for <testsuite> tag.
@@ -199,63 +288,7 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
             if (test->Group != testsuite_id)
                 continue;
 
-            // Attributes for <testcase> tag.
-            const char* testcase_name = test->Name;
-            const char* testcase_classname = test->Category;
-            const char* testcase_status = teststatus_names[test->Status + 1];   // +1 because _Unknown status is -1.
-            float testcase_time = (float)((double)(test->EndTime - test->StartTime) / 1000000.0);
-
-            fprintf(fp, "    <testcase name=\"%s\" assertions=\"0\" classname=\"%s\" status=\"%s\" time=\"%.3f\">\n",
-                testcase_name, testcase_classname, testcase_status, testcase_time);
-
-            if (test->Status == ImGuiTestStatus_Error)
-            {
-                // Skip last error message because it is generic information that test failed.
-                Str128 log_line;
-                for (int i = test->TestLog.LineInfo.Size - 2; i >= 0; i--)
-                {
-                    ImGuiTestLogLineInfo* line_info = &test->TestLog.LineInfo[i];
-                    if (line_info->Level > engine->IO.ConfigVerboseLevelOnError)
-                        continue;
-                    if (line_info->Level == ImGuiTestVerboseLevel_Error)
-                    {
-                        const char* line_start = test->TestLog.Buffer.c_str() + line_info->LineOffset;
-                        const char* line_end = strstr(line_start, "\n");
-                        log_line.set(line_start, line_end);
-                        ImStrXmlEscape(&log_line);
-                        break;
-                    }
-                }
-
-                // Failing tests save their "on error" log output in text element of <failure> tag.
-                fprintf(fp, "      <failure message=\"%s\" type=\"error\">\n", log_line.c_str());
-                ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, engine->IO.ConfigVerboseLevelOnError);
-                fprintf(fp, "      </failure>\n");
-            }
-
-            if (test->Status == ImGuiTestStatus_Unknown)
-            {
-                fprintf(fp, "      <skipped message=\"Skipped\" />\n");
-            }
-            else
-            {
-                // Succeeding tests save their defaiult log output output as "stdout".
-                if (ImGuiTestEngine_HasAnyLogLines(&test->TestLog, engine->IO.ConfigVerboseLevel))
-                {
-                    fprintf(fp, "      <system-out>\n");
-                    ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, engine->IO.ConfigVerboseLevel);
-                    fprintf(fp, "      </system-out>\n");
-                }
-
-                // Save error messages as "stderr".
-                if (ImGuiTestEngine_HasAnyLogLines(&test->TestLog, ImGuiTestVerboseLevel_Error))
-                {
-                    fprintf(fp, "      <system-err>\n");
-                    ImGuiTestEngine_PrintLogLines(fp, &test->TestLog, 8, ImGuiTestVerboseLevel_Error);
-                    fprintf(fp, "      </system-err>\n");
-                }
-            }
-            fprintf(fp, "    </testcase>\n");
+            ImGuiTestEngine_ExportJUnitXmlTestCase(engine, fp, test, false);
         }
 
         if (testsuites[testsuite_id].Disabled < testsuites[testsuite_id].Tests) // Any tests executed
@@ -297,3 +330,355 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
     fclose(fp);
     fprintf(stdout, "Saved test results to '%s' successfully.\n", output_file);
 }
+
+// JSON has no literal for NaN or infinity (e.g. perf value of a failed measurement): write null instead.
+static const char* ImGuiTestEngine_FormatJsonNumber(Str32* out, double value, int decimals)
+{
+    if (isfinite(value))
+        out->setf("%.*f", decimals, value);
+    else
+        out->set("null");
+    return out->c_str();
+}
+
+// Write log lines as comma separated JSON strings, filtered with same verbose level as JUnit output.
+static void ImGuiTestEngine_ExportJsonLogLines(ImGuiTestEngine* engine, FILE* fp, ImGuiTest* test)
+{
+    const ImGuiTestVerboseLevel level = (test->Status == ImGuiTestStatus_Error) ? engine->IO.ConfigVerboseLevelOnError : engine->IO.ConfigVerboseLevel;
+    ImGuiTestLog* test_log = &test->TestLog;
+    Str128 log_line;
+    ImGuiTextBuffer line_buf;
+    int lines_count = 0;
+    for (int line_no = 0; line_no < test_log->LineInfo.Size && test->Status != ImGuiTestStatus_Unknown; line_no++)
+    {
+        if (test_log->LineInfo[line_no].Level > level)
+            continue;
+        line_buf.Buf.resize(0);
+        test_log->FormatLine(line_no, &line_buf);
+        log_line.set(line_buf.begin(), line_buf.end() - 1); // Strip trailing '\n'
+        ImStrJsonEscape(&log_line);
+        fprintf(fp, "%s\"%s\"", (lines_count++ > 0) ? "," : "", log_line.c_str());
+    }
+}
+
+// One JSON object per line, per test.
+static void ImGuiTestEngine_ExportJsonLinesRecord(ImGuiTestEngine* engine, FILE* fp, ImGuiTest* test)
+{
+    Str30 batch_timestamp;
+    ImTimestampToISO8601(engine->BatchStartTime, &batch_timestamp);
+    Str256 name(test->Name);
+    Str256 category(test->Category);
+    ImStrJsonEscape(&name);
+    ImStrJsonEscape(&category);
+    const float time = (float)((double)(test->EndTime - test->StartTime) / 1000000.0);
+    fprintf(fp, "{\"batch\":\"%s\",\"group\":\"%s\",\"category\":\"%s\",\"name\":\"%s\",\"status\":\"%s\",\"time\":%.3f,\"log\":[",
+        batch_timestamp.c_str(), ImGuiTestEngine_GetGroupName(test->Group), category.c_str(), name.c_str(), ImGuiTestEngine_GetStatusName(test->Status), time);
+    ImGuiTestEngine_ExportJsonLogLines(engine, fp, test);
+    fprintf(fp, "]}\n");
+}
+
+void ImGuiTestEngine_ExportJsonLines(ImGuiTestEngine* engine, const char* output_file)
+{
+    IM_ASSERT(engine != NULL);
+    IM_ASSERT(output_file != NULL);
+
+    FILE* fp = fopen(output_file, "w+b");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Writing '%s' failed.\n", output_file);
+        return;
+    }
+    for (ImGuiTest* test : engine->TestsAll)
+        ImGuiTestEngine_ExportJsonLinesRecord(engine, fp, test);
+    fclose(fp);
+    fprintf(stdout, "Saved test results to '%s' successfully.\n", output_file);
+}
+
+// Single JSON document per batch. Records are written to the file as they are formatted, so memory usage does
+// not grow with the number of tests. Layout (schema version 1):
+//     { "schema": "imgui_test_engine.results", "version": 1,
+//       "batch": { "timestamp", "time", "git_branch", "build": {...}, "tests", "success", "errors", "skipped" },
+//       "tests": [ { "group", "category", "name", "status", "time_wall", "time_simulated", "frames", "yields",
+//                    "log_counts": { "error", "warning", "info", "debug", "trace", "trimmed" },
+//                    "perf": [ { "category", "name", "dt_ref_ms", "dt_delta_ms", "stress", "iterations" } ],
+//                    "log": [...] }, ... ] }
+// - "time_wall" is wall clock time, "time_simulated" is the sum of io.DeltaTime (differs in Fast/virtual clock runs).
+// - "log_counts" counts lines at export time, "trimmed" lines were discarded by io.ConfigLogMaxLinesOnSuccess.
+// - Numbers which are NaN or infinite are written as null.
+void ImGuiTestEngine_ExportJson(ImGuiTestEngine* engine, const char* output_file)
+{
+    IM_ASSERT(engine != NULL);
+    IM_ASSERT(output_file != NULL);
+
+    FILE* fp = fopen(output_file, "w+b");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Writing '%s' failed.\n", output_file);
+        return;
+    }
+
+    int count_tests = 0, count_success = 0, count_errors = 0, count_skipped = 0;
+    for (ImGuiTest* test : engine->TestsAll)
+    {
+        count_tests++;
+        if (test->Status == ImGuiTestStatus_Success)
+            count_success++;
+        else if (test->Status == ImGuiTestStatus_Error)
+            count_errors++;
+        else if (test->Status == ImGuiTestStatus_Unknown)
+            count_skipped++;
+    }
+
+    // Batch header
+    const ImBuildInfo* build_info = ImBuildGetCompilationInfo();
+    Str30 batch_timestamp;
+    ImTimestampToISO8601(engine->BatchStartTime, &batch_timestamp);
+    Str64 git_branch(engine->IO.GitBranchName);
+    ImStrJsonEscape(&git_branch);
+    const float batch_time = (float)((double)(engine->BatchEndTime - engine->BatchStartTime) / 1000000.0);
+    fprintf(fp, "{\n\"schema\":\"imgui_test_engine.results\",\n\"version\":1,\n");
+    fprintf(fp, "\"batch\":{\"timestamp\":\"%s\",\"time\":%.3f,\"git_branch\":\"%s\",\"build\":{\"type\":\"%s\",\"cpu\":\"%s\",\"os\":\"%s\",\"compiler\":\"%s\",\"date\":\"%s\"},\"tests\":%d,\"success\":%d,\"errors\":%d,\"skipped\":%d},\n",
+        batch_timestamp.c_str(), batch_time, git_branch.c_str(), build_info->Type, build_info->Cpu, build_info->OS, build_info->Compiler, build_info->Date,
+        count_tests, count_success, count_errors, count_skipped);
+
+    // One test per line
+    fprintf(fp, "\"tests\":[\n");
+    Str256 name, category;
+    Str32 number_a, number_b;
+    for (int n = 0; n < engine->TestsAll.Size; n++)
+    {
+        ImGuiTest* test = engine->TestsAll[n];
+        name.set(test->Name);
+        category.set(test->Category);
+        ImStrJsonEscape(&name);
+        ImStrJsonEscape(&category);
+        const float time_wall = (float)((double)(test->EndTime - test->StartTime) / 1000000.0);
+        const int* counts = test->TestLog.CountPerLevel;
+        fprintf(fp, "{\"group\":\"%s\",\"category\":\"%s\",\"name\":\"%s\",\"status\":\"%s\",\"time_wall\":%.3f,\"time_simulated\":%s,\"frames\":%d,\"yields\":%d,",
+            ImGuiTestEngine_GetGroupName(test->Group), category.c_str(), name.c_str(), ImGuiTestEngine_GetStatusName(test->Status), time_wall, ImGuiTestEngine_FormatJsonNumber(&number_a, test->SimulatedTime, 3), test->FrameCount, test->YieldCount);
+        fprintf(fp, "\"log_counts\":{\"error\":%d,\"warning\":%d,\"info\":%d,\"debug\":%d,\"trace\":%d,\"trimmed\":%d},",
+            counts[ImGuiTestVerboseLevel_Error], counts[ImGuiTestVerboseLevel_Warning], counts[ImGuiTestVerboseLevel_Info], counts[ImGuiTestVerboseLevel_Debug], counts[ImGuiTestVerboseLevel_Trace], test->TestLog.LinesTrimmed);
+        fprintf(fp, "\"perf\":[");
+        for (int perf_n = 0; perf_n < test->PerfCaptures.Size; perf_n++)
+        {
+            const ImGuiTestPerfCaptureResult* perf = &test->PerfCaptures[perf_n];
+            name.set(perf->TestName);
+            category.set(perf->Category);
+            ImStrJsonEscape(&name);
+            ImStrJsonEscape(&category);
+            fprintf(fp, "%s{\"category\":\"%s\",\"name\":\"%s\",\"dt_ref_ms\":%s,\"dt_delta_ms\":%s,\"stress\":%d,\"iterations\":%d}",
+                (perf_n > 0) ? "," : "", category.c_str(), name.c_str(), ImGuiTestEngine_FormatJsonNumber(&number_a, perf->DtRefMs, 6), ImGuiTestEngine_FormatJsonNumber(&number_b, perf->DtDeltaMs, 6), perf->PerfStressAmount, perf->PerfIterations);
+        }
+        fprintf(fp, "],\"log\":[");
+        ImGuiTestEngine_ExportJsonLogLines(engine, fp, test);
+        fprintf(fp, "]}%s\n", (n + 1 < engine->TestsAll.Size) ? "," : "");
+    }
+    fprintf(fp, "]\n}\n");
+    fclose(fp);
+    fprintf(stdout, "Saved test results to '%s' successfully.\n", output_file);
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] STREAMING EXPORTER
+//-------------------------------------------------------------------------
+// - ImGuiTestEngine_ExportStreamBegin()
+// - ImGuiTestEngine_ExportStreamTest()
+// - ImGuiTestEngine_ExportStreamEnd()
+// - ImGuiTestEngine_ExportStreamMerge()
+//-------------------------------------------------------------------------
+// A record is appended to io.ExportResultsStreamFilename as soon as each test completes, and stdio buffers are
+// flushed so other processes may follow results live. The file is synced to disk every io.ExportResultsStreamSyncInterval
+// seconds, and by the crash handler which also appends the test which was running. Records are self-contained, so
+// a truncated last record (e.g. killed while writing) is simply dropped by ImGuiTestEngine_ExportStreamMerge().
+//-------------------------------------------------------------------------
+
+// Called at the beginning of a batch. Records are appended to existing file, delete it to start over.
+void ImGuiTestEngine_ExportStreamBegin(ImGuiTestEngine* engine)
+{
+    ImGuiTestEngineIO& io = engine->IO;
+    if (engine->ExportStreamFile != NULL || io.ExportResultsStreamFilename == NULL || io.ExportResultsStreamFormat == ImGuiTestEngineExportFormat_None)
+        return;
+    IM_ASSERT(io.ExportResultsStreamFormat == ImGuiTestEngineExportFormat_JUnitXml || io.ExportResultsStreamFormat == ImGuiTestEngineExportFormat_JsonLines);
+    engine->ExportStreamFile = fopen(io.ExportResultsStreamFilename, "ab");
+    if (engine->ExportStreamFile == NULL)
+        fprintf(stderr, "Writing '%s' failed.\n", io.ExportResultsStreamFilename);
+    engine->ExportStreamFormat = io.ExportResultsStreamFormat;
+    engine->ExportStreamLastSyncTime = ImTimeGetInMicroseconds();
+}
+
+void ImGuiTestEngine_ExportStreamTest(ImGuiTestEngine* engine, ImGuiTest* test)
+{
+    FILE* fp = engine->ExportStreamFile;
+    if (fp == NULL)
+        return;
+    if (engine->ExportStreamFormat == ImGuiTestEngineExportFormat_JUnitXml)
+        ImGuiTestEngine_ExportJUnitXmlTestCase(engine, fp, test, true);
+    else
+        ImGuiTestEngine_ExportJsonLinesRecord(engine, fp, test);
+
+    const ImU64 time_now = ImTimeGetInMicroseconds();
+    if ((double)(time_now - engine->ExportStreamLastSyncTime) >= (double)engine->IO.ExportResultsStreamSyncInterval * 1000000.0)
+    {
+        ImFileSyncToDisk(fp);
+        engine->ExportStreamLastSyncTime = time_now;
+    }
+    else
+    {
+        fflush(fp);
+    }
+}
+
+// Called at the end of a batch, and by crash handler.
+void ImGuiTestEngine_ExportStreamEnd(ImGuiTestEngine* engine)
+{
+    if (engine->ExportStreamFile == NULL)
+        return;
+    ImFileSyncToDisk(engine->ExportStreamFile);
+    fclose(engine->ExportStreamFile);
+    engine->ExportStreamFile = NULL;
+}
+
+// Merge one or more stream files into a regular results file:
+// - ImGuiTestEngineExportFormat_JUnitXml: <testcase> fragments are grouped into a complete JUnit document.
+// - ImGuiTestEngineExportFormat_JsonLines: records are concatenated.
+// Incomplete records are dropped. Return false if an input can't be read or output can't be written.
+bool ImGuiTestEngine_ExportStreamMerge(const char* const* input_files, int input_count, ImGuiTestEngineExportFormat format, const char* output_file)
+{
+    IM_ASSERT(format == ImGuiTestEngineExportFormat_JUnitXml || format == ImGuiTestEngineExportFormat_JsonLines);
+    IM_ASSERT(output_file != NULL);
+
+    // A complete record found in one of the input files
+    struct Record
+    {
+        const char*     Begin;
+        const char*     End;
+        ImGuiTestGroup  Group;
+        bool            Failed;
+        bool            Skipped;
+        float           Time;
+    };
+    ImVector<char*> inputs_data;
+    ImVector<Record> records;
+    bool ret = true;
+    for (int input_n = 0; input_n < input_count; input_n++)
+    {
+        size_t data_size = 0;
+        char* data = (char*)ImFileLoadToMemory(input_files[input_n], "rb", &data_size, 1);
+        if (data == NULL)
+        {
+            fprintf(stderr, "Reading '%s' failed.\n", input_files[input_n]);
+            ret = false;
+            continue;
+        }
+        inputs_data.push_back(data);
+
+        const char* data_end = data + data_size;
+        const char* record_begin = NULL;
+        Record record = {};
+        for (const char* line = data; line < data_end; )
+        {
+            const char* line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+            if (line_end == NULL)
+                break;          // Truncated line
+            line_end++;
+            if (format == ImGuiTestEngineExportFormat_JsonLines)
+            {
+                if (line[0] == '{' && line_end - line >= 3 && line_end[-2] == '}')
+                {
+                    record.Begin = line;
+                    record.End = line_end;
+                    records.push_back(record);
+                }
+            }
+            else if (strncmp(line, "    <testcase ", 14) == 0)
+            {
+                Str256 line_str;
+                line_str.set(line, line_end);
+                const char* time_attr = strstr(line_str.c_str(), " time=\"");
+                record_begin = line;
+                record.Group = ImGuiTestGroup_Tests;
+                record.Failed = strstr(line_str.c_str(), " status=\"error\"") != NULL;
+                record.Skipped = strstr(line_str.c_str(), " status=\"skipped\"") != NULL;
+                record.Time = time_attr ? (float)atof(time_attr + 7) : 0.0f;
+            }
+            else if (record_begin != NULL && strncmp(line, "      <properties><property name=\"group\" value=\"perfs\"", 54) == 0)
+            {
+                record.Group = ImGuiTestGroup_Perfs;
+            }
+            else if (record_begin != NULL && strncmp(line, "      <properties><property name=\"group\" value=\"microbenchs\"", 60) == 0)
+            {
+                record.Group = ImGuiTestGroup_MicroBenchs;
+            }
+            else if (record_begin != NULL && strncmp(line, "    </testcase>", 15) == 0)
+            {
+                record.Begin = record_begin;
+                record.End = line_end;
+                records.push_back(record);
+                record_begin = NULL;
+            }
+            line = line_end;
+        }
+    }
+
+    FILE* fp = fopen(output_file, "w+b");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Writing '%s' failed.\n", output_file);
+        ret = false;
+    }
+    else if (format == ImGuiTestEngineExportFormat_JsonLines)
+    {
+        for (const Record& record : records)
+            fwrite(record.Begin, 1, (size_t)(record.End - record.Begin), fp);
+        fclose(fp);
+    }
+    else
+    {
+        // Per-testsuite test statistics.
+        struct
+        {
+            int         Tests    = 0;
+            int         Failures = 0;
+            int         Disabled = 0;
+            float       Time     = 0.0f;
+        } testsuites[ImGuiTestGroup_COUNT], total;
+        for (const Record& record : records)
+        {
+            auto* stats = &testsuites[record.Group];
+            stats->Tests += 1;
+            stats->Failures += record.Failed ? 1 : 0;
+            stats->Disabled += record.Skipped ? 1 : 0;
+            stats->Time += record.Time;
+        }
+        for (int testsuite_id = ImGuiTestGroup_Tests; testsuite_id < ImGuiTestGroup_COUNT; testsuite_id++)
+        {
+            total.Tests += testsuites[testsuite_id].Tests;
+            total.Failures += testsuites[testsuite_id].Failures;
+            total.Disabled += testsuites[testsuite_id].Disabled;
+            total.Time += testsuites[testsuite_id].Time;
+        }
+        Str30 timestamp;
+        ImTimestampToISO8601(ImTimeGetInMicroseconds(), &timestamp);
+        fprintf(fp, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<testsuites disabled=\"%d\" errors=\"0\" failures=\"%d\" name=\"Dear ImGui\" tests=\"%d\" time=\"%.3f\">\n",
+            total.Disabled, total.Failures, total.Tests, total.Time);
+        for (int testsuite_id = ImGuiTestGroup_Tests; testsuite_id < ImGuiTestGroup_COUNT; testsuite_id++)
+        {
+            auto* testsuite = &testsuites[testsuite_id];
+            fprintf(fp, "  <testsuite name=\"%s\" tests=\"%d\" disabled=\"%d\" errors=\"0\" failures=\"%d\" hostname=\"\" id=\"%d\" package=\"\" skipped=\"0\" time=\"%.3f\" timestamp=\"%s\">\n",
+                ImGuiTestEngine_GetGroupName((ImGuiTestGroup)testsuite_id), testsuite->Tests, testsuite->Disabled, testsuite->Failures, testsuite_id, testsuite->Time, timestamp.c_str());
+            for (const Record& record : records)
+                if (record.Group == testsuite_id)
+                    fwrite(record.Begin, 1, (size_t)(record.End - record.Begin), fp);
+            fprintf(fp, "  </testsuite>\n");
+        }
+        fprintf(fp, "</testsuites>\n");
+        fclose(fp);
+    }
+    if (fp != NULL)
+        fprintf(stdout, "Merged %d test results to '%s'.\n", records.Size, output_file);
+
+    for (char* data : inputs_data)
+        IM_FREE(data);
+    return ret;
+}
@@ -32,11 +32,34 @@
 //          node_modules/xunit-viewer/bin/xunit-viewer -r junit.xml -o junit.html
 //    - Open junit.html
 //
+// JSON Lines format
+//-------------------
+// One JSON object per test and per line (https://jsonlines.org/):
+//     {"batch":"2026-10-19T12:00:00","group":"tests","category":"widgets","name":"widgets_button","status":"success","time":0.120,"log":[...]}
+//
+// JSON format
+//-------------
+// One document per batch, with batch information (timestamp, build, counts) and for each test: status, wall clock
+// and simulated time, frame and yield counts, log line counts per level and PerfCapture() results. See
+// ImGuiTestEngine_ExportJson() in imgui_te_exporters.cpp for the full layout. The "version" field is bumped on
+// incompatible changes.
+//
+// Streaming
+//-----------
+// For long runs, results may also be appended to a file as soon as each test completes, so they can be followed
+// live and survive a crash (at most the test running at the time of crash is lost):
+//
+//     test_io.ExportResultsStreamFilename = "output_file.jsonl";
+//     test_io.ExportResultsStreamFormat = ImGuiTestEngineExportFormat_JsonLines; // or _JUnitXml for <testcase> fragments
+//
+// Use ImGuiTestEngine_ExportStreamMerge() to turn one or more stream files (e.g. from parallel shards) into a regular results file.
+//
 
 //-------------------------------------------------------------------------
 // Forward Declarations
 //-------------------------------------------------------------------------
 
+struct ImGuiTest;
 struct ImGuiTestEngine;
 
 //-------------------------------------------------------------------------
@@ -47,6 +70,8 @@ enum ImGuiTestEngineExportFormat : int
 {
     ImGuiTestEngineExportFormat_None = 0,
     ImGuiTestEngineExportFormat_JUnitXml,
+    ImGuiTestEngineExportFormat_JsonLines,
+    ImGuiTestEngineExportFormat_Json,
 };
 
 //-------------------------------------------------------------------------
@@ -57,3 +82,9 @@ void ImGuiTestEngine_PrintResultSummary(ImGuiTestEngine* engine);
 
 void ImGuiTestEngine_Export(ImGuiTestEngine* engine);
 void ImGuiTestEngine_ExportEx(ImGuiTestEngine* engine, ImGuiTestEngineExportFormat format, const char* filename);
+
+// Streaming (called by test engine)
+void ImGuiTestEngine_ExportStreamBegin(ImGuiTestEngine* engine);
+void ImGuiTestEngine_ExportStreamTest(ImGuiTestEngine* engine, ImGuiTest* test);
+void ImGuiTestEngine_ExportStreamEnd(ImGuiTestEngine* engine);
+bool ImGuiTestEngine_ExportStreamMerge(const char* const* input_files, int input_count, ImGuiTestEngineExportFormat format, const char* output_file);
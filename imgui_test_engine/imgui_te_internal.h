@@ -40,7 +40,7 @@ struct ImGuiTestGatherTask
 
     // Output/Temp
     ImGuiTestItemList*      OutList = NULL;
-    ImGuiTestItemInfo*      LastItemInfo = NULL;
+    ImGuiID                 LastItemID = 0;         // Last item added to OutList, so ItemInfo() hook can update its status flags and label
 
     void Clear() { memset(this, 0, sizeof(*this)); }
 };
@@ -66,6 +66,7 @@ struct ImGuiTestRunTask
 {
     ImGuiTest*              Test = NULL;
     ImGuiTestRunFlags       RunFlags = ImGuiTestRunFlags_None;
+    int                     PerfStressAmount = 0;   // Override io.PerfStressAmount when > 0 (used by io.PerfStressSweepMax)
 };
 
 enum ImGuiTestInputType
@@ -73,6 +74,7 @@ enum ImGuiTestInputType
     ImGuiTestInputType_None,
     ImGuiTestInputType_Key,
     ImGuiTestInputType_Char,
+    ImGuiTestInputType_MouseButton,     // Only queued by input bursts, otherwise mouse buttons are applied from ImGuiTestInputs::MouseButtonsValue
     ImGuiTestInputType_ViewportFocus
 };
 
@@ -82,6 +84,7 @@ struct ImGuiTestInput
     ImGuiTestInputType      Type = ImGuiTestInputType_None;
     ImGuiKeyChord           KeyChord = ImGuiKey_None;
     ImWchar                 Char = 0;
+    ImGuiMouseButton        MouseButton = 0;
     bool                    Down = false;
     ImGuiID                 ViewportId = 0;
 
@@ -102,6 +105,15 @@ struct ImGuiTestInput
         return inp;
     }
 
+    static ImGuiTestInput   ForMouseButton(ImGuiMouseButton button, bool down)
+    {
+        ImGuiTestInput inp;
+        inp.Type = ImGuiTestInputType_MouseButton;
+        inp.MouseButton = button;
+        inp.Down = down;
+        return inp;
+    }
+
     static ImGuiTestInput   ForViewportFocus(ImGuiID viewport_id)
     {
         ImGuiTestInput inp;
@@ -155,6 +167,7 @@ struct ImGuiTestEngine
     ImGuiTest*                  UiSelectedTest = NULL;
     Str*                        UiFilterTests;
     Str*                        UiFilterPerfs;
+    Str*                        UiFilterMicroBenchs;
     ImU32                       UiFilterByStatusMask = ~0u;
     bool                        UiMetricsOpen = false;
     bool                        UiDebugLogOpen = false;
@@ -168,12 +181,18 @@ struct ImGuiTestEngine
     ImMovingAverage<double>     PerfDeltaTime100;
     ImMovingAverage<double>     PerfDeltaTime500;
     ImGuiPerfTool*              PerfTool = NULL;
+    ImVector<char*>             PerfNamesPool;                  // Names generated at runtime for perf tool entries (which reference names by pointer)
 
     // Screen/Video Capturing
     ImGuiCaptureToolUI          CaptureTool;                        // Capture tool UI
     ImGuiCaptureContext         CaptureContext;                     // Capture context used in tests
     ImGuiCaptureArgs*           CaptureCurrentArgs = NULL;
 
+    // Streaming export
+    FILE*                       ExportStreamFile = NULL;
+    ImGuiTestEngineExportFormat ExportStreamFormat = (ImGuiTestEngineExportFormat)0;
+    ImU64                       ExportStreamLastSyncTime = 0;
+
     // Tools
     bool                        PostSwapCalled = false;
     bool                        ToolDebugRebootUiContext = false;   // Completely shutdown and recreate the dear imgui context in place
@@ -197,7 +216,6 @@ void                ImGuiTestEngine_SetDeltaTime(ImGuiTestEngine* engine, float
 int                 ImGuiTestEngine_GetFrameCount(ImGuiTestEngine* engine);
 bool                ImGuiTestEngine_PassFilter(ImGuiTest* test, const char* filter);
 
-void                ImGuiTestEngine_RebootUiContext(ImGuiTestEngine* engine);
 ImGuiPerfTool*      ImGuiTestEngine_GetPerfTool(ImGuiTestEngine* engine);
 
 // Screen/Video Capturing
@@ -19,7 +19,8 @@ Index of this file:
 // * Entry: information about execution of a single perf test. This corresponds to one line in CSV file.
 // * Batch: a group of entries that were created together during a single execution. A new batch is created each time
 //   one or more perf tests are executed. All entries in a single batch will have a matching ImGuiPerflogEntry::Timestamp.
-// * Build: A group of batches that have matching BuildType, OS, Cpu, Compiler, GitBranchName.
+// * Build: A group of batches that have matching BuildType, OS, Cpu, Compiler, GitBranchName, PerfStressAmount.
+// * Scaling fit: the curve of a perf test over stress amounts within a build (ignoring PerfStressAmount).
 // * Baseline: A batch that we are comparing against. Baselines are identified by batch timestamp and build id.
 
 //-------------------------------------------------------------------------
@@ -191,7 +192,7 @@ static bool Button3(const char* label, int* value)
     return pressed;
 }
 
-static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
+static ImGuiID GetBuildInfoID(const ImGuiPerfToolEntry* entry)
 {
     IM_ASSERT(entry != NULL);
     ImGuiID build_id = ImHashStr(entry->BuildType);
@@ -202,6 +203,12 @@ static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
     return build_id;
 }
 
+// Entries recorded with different stress amounts are not comparable, so they are kept in separate builds.
+static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
+{
+    return ImHashData(&entry->PerfStressAmount, sizeof(entry->PerfStressAmount), GetBuildInfoID(entry));
+}
+
 static ImGuiID GetBuildID(const ImGuiPerfToolBatch* batch)
 {
     IM_ASSERT(batch != NULL);
@@ -787,6 +794,8 @@ void ImGuiPerfTool::_Rebuild()
 
     _CalculateLegendAlignment();
     temp_set.Data.resize(0);
+
+    CalcScalingFits(&_ScalingFits);
 }
 
 void ImGuiPerfTool::Clear()
@@ -796,6 +805,7 @@ void ImGuiPerfTool::Clear()
     _Batches.clear_destruct();
     _Visibility.Clear();
     _SrcData.clear_destruct();
+    _ScalingFits.clear();
     _CsvParser->Clear();
 
     ImStrncpy(_FilterDateFrom, "9999-99-99", IM_ARRAYSIZE(_FilterDateFrom));
@@ -871,6 +881,162 @@ ImGuiPerfToolEntry* ImGuiPerfTool::GetEntryByBatchIdx(int idx, const char* perf_
     return NULL;
 }
 
+const char* ImGuiTestEngine_PerfToolGetScalingModelName(ImGuiPerfToolScalingModel model)
+{
+    static const char* names[ImGuiPerfToolScalingModel_COUNT] = { "N/A", "O(n)", "O(n log n)", "O(n^2)" };
+    return (model >= 0 && model < ImGuiPerfToolScalingModel_COUNT) ? names[model] : "N/A";
+}
+
+static double PerfToolScalingModelEval(ImGuiPerfToolScalingModel model, double x)
+{
+    switch (model)
+    {
+    case ImGuiPerfToolScalingModel_Linear:      return x;
+    case ImGuiPerfToolScalingModel_NLogN:       return x * log2(2.0 * x);
+    case ImGuiPerfToolScalingModel_Quadratic:   return x * x;
+    default:                                    IM_ASSERT(0); return 0.0;
+    }
+}
+
+static int IMGUI_CDECL PerfToolComparerByScalingKey(const void* lhs, const void* rhs)
+{
+    const ImGuiPerfToolEntry* a = *(const ImGuiPerfToolEntry* const*)lhs;
+    const ImGuiPerfToolEntry* b = *(const ImGuiPerfToolEntry* const*)rhs;
+    int result = strcmp(a->TestName, b->TestName);
+    if (result == 0)
+        result = (GetBuildInfoID(a) < GetBuildInfoID(b)) ? -1 : (GetBuildInfoID(a) > GetBuildInfoID(b)) ? +1 : 0;
+    if (result == 0)
+        result = (a->Timestamp < b->Timestamp) ? -1 : (a->Timestamp > b->Timestamp) ? +1 : 0;
+    if (result == 0)
+        result = a->PerfStressAmount - b->PerfStressAmount;
+    return result;
+}
+
+static int IMGUI_CDECL PerfToolComparerScalingFitByBuild(const void* lhs, const void* rhs)
+{
+    const ImGuiPerfToolScalingFit* a = (const ImGuiPerfToolScalingFit*)lhs;
+    const ImGuiPerfToolScalingFit* b = (const ImGuiPerfToolScalingFit*)rhs;
+    int result = strcmp(a->TestName, b->TestName);
+    if (result == 0)
+        result = (a->BuildID < b->BuildID) ? -1 : (a->BuildID > b->BuildID) ? +1 : 0;
+    if (result == 0)
+        result = (a->Timestamp < b->Timestamp) ? -1 : (a->Timestamp > b->Timestamp) ? +1 : 0;
+    return result;
+}
+
+// Fit scaling curves over entries recorded at different stress amounts, one per test, build and batch (ignoring stress amount).
+// A stress sweep (io.PerfStressSweepMax) records all its stress amounts in a single batch.
+// - Exponent is the least squares slope of log(dt) over log(stress), which doesn't assume any model.
+// - Model is the best of c*n, c*n*log2(2n) and c*n^2 by relative residuals (stress amount is a multiplier of
+//   item count, so log2(2n) stands for the unknown log of the real item count).
+// - Fits of a same test and build information (branch, build type, cpu, OS, compiler) are ordered by batch timestamp,
+//   ExponentChanged is set when exponent moved by more than 'exponent_threshold' compared to the previous batch.
+//   Different build configurations are never compared with each other.
+// Entries with dt <= 0 (noise on very light tests) are ignored. At least 3 distinct stress amounts are required.
+void ImGuiPerfTool::CalcScalingFits(ImVector<ImGuiPerfToolScalingFit>* out_fits, double exponent_threshold) const
+{
+    out_fits->resize(0);
+
+    ImVector<const ImGuiPerfToolEntry*> entries;
+    entries.reserve(_SrcData.Size);
+    for (const ImGuiPerfToolEntry& entry : _SrcData)
+        if (entry.DtDeltaMs > 0.0 && entry.PerfStressAmount > 0)
+            entries.push_back(&entry);
+    if (entries.empty())
+        return;
+    ImQsort(entries.Data, (size_t)entries.Size, sizeof(const ImGuiPerfToolEntry*), PerfToolComparerByScalingKey);
+
+    struct ScalingPoint { double Stress; double DtSum; int Count; };
+    ImVector<ScalingPoint> points;
+    for (int group_start = 0; group_start < entries.Size;)
+    {
+        const ImGuiPerfToolEntry* first = entries[group_start];
+        const ImGuiID build_info_id = GetBuildInfoID(first);
+        ImGuiPerfToolScalingFit fit;
+        fit.TestName = first->TestName;
+        fit.GitBranchName = first->GitBranchName;
+        fit.BuildType = first->BuildType;
+        fit.Cpu = first->Cpu;
+        fit.OS = first->OS;
+        fit.Compiler = first->Compiler;
+        fit.BuildID = build_info_id;
+        fit.Timestamp = first->Timestamp;
+
+        // Average samples per stress amount
+        points.resize(0);
+        int group_end = group_start;
+        for (; group_end < entries.Size; group_end++)
+        {
+            const ImGuiPerfToolEntry* entry = entries[group_end];
+            if (strcmp(entry->TestName, first->TestName) != 0 || GetBuildInfoID(entry) != build_info_id || entry->Timestamp != first->Timestamp)
+                break;
+            if (points.empty() || points.back().Stress != (double)entry->PerfStressAmount)
+                points.push_back({ (double)entry->PerfStressAmount, 0.0, 0 });
+            points.back().DtSum += entry->DtDeltaMs;
+            points.back().Count++;
+        }
+        group_start = group_end;
+
+        fit.NumPoints = points.Size;
+        if (points.Size < 3)
+            continue;
+        fit.StressMin = (int)points.front().Stress;
+        fit.StressMax = (int)points.back().Stress;
+
+        // Exponent: least squares slope in log-log space
+        double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+        for (const ScalingPoint& point : points)
+        {
+            const double x = log(point.Stress);
+            const double y = log(point.DtSum / point.Count);
+            sum_x += x; sum_y += y; sum_xx += x * x; sum_xy += x * y;
+        }
+        const double n = (double)points.Size;
+        fit.Exponent = (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+
+        // Model: single coefficient fit minimizing relative residuals (1 - c * f(x) / y)
+        fit.ModelError = DBL_MAX;
+        for (int model = ImGuiPerfToolScalingModel_Linear; model < ImGuiPerfToolScalingModel_COUNT; model++)
+        {
+            double sum_r = 0.0, sum_rr = 0.0;
+            for (const ScalingPoint& point : points)
+            {
+                const double f = PerfToolScalingModelEval((ImGuiPerfToolScalingModel)model, point.Stress);
+                const double r = f / (point.DtSum / point.Count);
+                sum_r += r;
+                sum_rr += r * r;
+            }
+            const double c = sum_r / sum_rr;
+            double err = 0.0;
+            for (const ScalingPoint& point : points)
+            {
+                const double f = PerfToolScalingModelEval((ImGuiPerfToolScalingModel)model, point.Stress);
+                const double residual = 1.0 - c * f / (point.DtSum / point.Count);
+                err += residual * residual;
+            }
+            err = sqrt(err / n);
+            if (err < fit.ModelError)
+            {
+                fit.ModelError = err;
+                fit.Model = (ImGuiPerfToolScalingModel)model;
+            }
+        }
+        out_fits->push_back(fit);
+    }
+
+    // Order batches of a same test and build by timestamp and compare each against previous one
+    ImQsort(out_fits->Data, (size_t)out_fits->Size, sizeof(ImGuiPerfToolScalingFit), PerfToolComparerScalingFitByBuild);
+    for (int n = 1; n < out_fits->Size; n++)
+    {
+        ImGuiPerfToolScalingFit* prev = &out_fits->Data[n - 1];
+        ImGuiPerfToolScalingFit* fit = &out_fits->Data[n];
+        if (strcmp(prev->TestName, fit->TestName) != 0 || prev->BuildID != fit->BuildID)
+            continue;
+        fit->PrevExponent = prev->Exponent;
+        fit->ExponentChanged = ImAbs(fit->Exponent - prev->Exponent) > exponent_threshold;
+    }
+}
+
 bool ImGuiPerfTool::_IsVisibleBuild(ImGuiPerfToolBatch* batch)
 {
     IM_ASSERT(batch != NULL);
@@ -1156,6 +1322,12 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
     if (ImGui::IsItemHovered())
         ImGui::SetTooltip("Generate a report and open it in the browser.");
 
+    if (ImGui::Button(Str64f("Scaling (%d)###Scaling", _ScalingFits.Size).c_str()))
+        ImGui::OpenPopup("Scaling curves");
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Scaling curves of perf tests recorded at multiple stress amounts (-stresssweep).");
+    ImGui::SameLine();
+
     // Align help button to the right.
     float help_pos = ImGui::GetWindowContentRegionMax().x - style.FramePadding.x * 2 - ImGui::CalcTextSize("(?)").x;
     if (help_pos > ImGui::GetCursorPosX())
@@ -1242,6 +1414,12 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
         ImGui::EndPopup();
     }
 
+    if (ImGui::BeginPopup("Scaling curves"))
+    {
+        _ShowScalingTable();
+        ImGui::EndPopup();
+    }
+
     if (ImGui::BeginPopup("Filter perfs"))
     {
         dirty |= RenderMultiSelectFilter(this, "Filter by perf test", &_Labels);
@@ -1689,6 +1867,50 @@ void ImGuiPerfTool::_ShowEntriesTable()
     ImGui::EndTable();
 }
 
+void ImGuiPerfTool::_ShowScalingTable()
+{
+    if (_ScalingFits.empty())
+    {
+        ImGui::TextUnformatted("No scaling data. Run perf tests with a stress sweep (io.PerfStressSweepMax) to record one.");
+        return;
+    }
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    if (!ImGui::BeginTable("Scaling", 7, table_flags, ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 20)))
+        return;
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Test");
+    ImGui::TableSetupColumn("Build");
+    ImGui::TableSetupColumn("Stress");
+    ImGui::TableSetupColumn("Exponent");
+    ImGui::TableSetupColumn("Model");
+    ImGui::TableSetupColumn("Error");
+    ImGui::TableSetupColumn("Prev Exponent");
+    ImGui::TableHeadersRow();
+    for (const ImGuiPerfToolScalingFit& fit : _ScalingFits)
+    {
+        ImGui::TableNextRow();
+        if (fit.ExponentChanged)
+            ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1, ImColor(1.0f, 0.0f, 0.0f, 0.2f));
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(fit.TestName);
+        ImGui::TableNextColumn();
+        ImGui::Text("%s %s %s %s %s", fit.GitBranchName, fit.BuildType, fit.Cpu, fit.OS, fit.Compiler);
+        ImGui::TableNextColumn();
+        ImGui::Text("x%d..x%d (%d)", fit.StressMin, fit.StressMax, fit.NumPoints);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", fit.Exponent);
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(ImGuiTestEngine_PerfToolGetScalingModelName(fit.Model));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f%%", fit.ModelError * 100.0);
+        ImGui::TableNextColumn();
+        if (fit.PrevExponent != 0.0)
+            ImGui::Text("%.2f%s", fit.PrevExponent, fit.ExponentChanged ? " (changed)" : "");
+    }
+    ImGui::EndTable();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] SETTINGS
 //-------------------------------------------------------------------------
@@ -1943,6 +2165,60 @@ void RegisterTests_TestEnginePerfTool(ImGuiTestEngine* e)
             perf_report_output = PerfToolReportDefaultOutputPath;
         perftool->SaveHtmlReport(perf_report_output, perf_report_image);
     };
+
+    // ## Scaling curves fitted over stress amounts, and exponent change between builds.
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_perftool_scaling_fit");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        // Batch 0: linear, batch 1: quadratic, both in Release. Batch 2: Debug build recorded in between, quadratic too.
+        ImGuiPerfTool perftool;
+        const ImU64 timestamps[] = { 1000, 1002, 1001 };
+        const char* build_types[] = { "Release", "Release", "Debug" };
+        for (int batch_n = 0; batch_n < 3; batch_n++)
+            for (int stress = 1; stress <= 16; stress *= 2)
+            {
+                ImGuiPerfToolEntry entry;
+                entry.Timestamp = timestamps[batch_n];
+                entry.Category = "perf";
+                entry.TestName = "perf_scaling";
+                entry.DtDeltaMs = (batch_n == 0) ? 0.1 * stress : 0.01 * stress * stress;
+                entry.PerfStressAmount = stress;
+                entry.GitBranchName = "master";
+                entry.BuildType = build_types[batch_n];
+                entry.Cpu = entry.OS = entry.Compiler = "";
+                entry.Date = "2026-01-01";
+                perftool.AddEntry(&entry);
+            }
+
+        ImVector<ImGuiPerfToolScalingFit> fits;
+        perftool.CalcScalingFits(&fits);
+        IM_CHECK_EQ(fits.Size, 3);
+        const ImGuiPerfToolScalingFit* fit_linear = NULL;
+        const ImGuiPerfToolScalingFit* fit_quadratic = NULL;
+        const ImGuiPerfToolScalingFit* fit_debug = NULL;
+        for (const ImGuiPerfToolScalingFit& fit : fits)
+        {
+            IM_CHECK_EQ(fit.NumPoints, 5);
+            if (strcmp(fit.BuildType, "Debug") == 0)
+                fit_debug = &fit;
+            else if (fit.Timestamp == timestamps[0])
+                fit_linear = &fit;
+            else
+                fit_quadratic = &fit;
+        }
+        IM_CHECK(fit_linear != NULL && fit_quadratic != NULL && fit_debug != NULL);
+        IM_CHECK(fit_linear + 1 == fit_quadratic); // Batches of a same build are consecutive, ordered by timestamp
+        IM_CHECK_EQ(fit_linear->Model, ImGuiPerfToolScalingModel_Linear);
+        IM_CHECK(ImAbs(fit_linear->Exponent - 1.0) < 0.01);
+        IM_CHECK_EQ(fit_linear->ExponentChanged, false);
+        IM_CHECK_EQ(fit_quadratic->Model, ImGuiPerfToolScalingModel_Quadratic);
+        IM_CHECK(ImAbs(fit_quadratic->Exponent - 2.0) < 0.01);
+        IM_CHECK_EQ(fit_quadratic->ExponentChanged, true);
+        IM_CHECK(ImAbs(fit_quadratic->PrevExponent - 1.0) < 0.01);
+        IM_CHECK_EQ(fit_debug->ExponentChanged, false);     // Not compared with Release build
+        IM_CHECK_EQ(fit_debug->PrevExponent, 0.0);
+        IM_UNUSED(ctx);
+    };
 }
 
 //-------------------------------------------------------------------------
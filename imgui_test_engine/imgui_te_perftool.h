@@ -57,6 +57,37 @@ struct ImGuiPerfToolBatch
     ~ImGuiPerfToolBatch()       { Entries.clear_destruct(); }   // FIXME: Misleading: nothing to destruct in that struct?
 };
 
+// Scaling model fitted over entries recorded at different stress amounts (see ImGuiTestEngineIO::PerfStressSweepMax).
+enum ImGuiPerfToolScalingModel : int
+{
+    ImGuiPerfToolScalingModel_Unknown,                          // Not enough samples (need 3 stress amounts with positive timings).
+    ImGuiPerfToolScalingModel_Linear,                           // O(n)
+    ImGuiPerfToolScalingModel_NLogN,                            // O(n log n)
+    ImGuiPerfToolScalingModel_Quadratic,                        // O(n^2)
+    ImGuiPerfToolScalingModel_COUNT
+};
+
+// [Internal] Scaling curve of one perf test in one batch of a build.
+struct ImGuiPerfToolScalingFit
+{
+    const char*                 TestName = NULL;
+    const char*                 GitBranchName = NULL;           // Build information.
+    const char*                 BuildType = NULL;               //
+    const char*                 Cpu = NULL;                     //
+    const char*                 OS = NULL;                      //
+    const char*                 Compiler = NULL;                //
+    ImGuiID                     BuildID = 0;                    // Hash of build information, excluding stress amount.
+    ImU64                       Timestamp = 0;                  // Timestamp of batch, used to order batches of a same build.
+    int                         NumPoints = 0;                  // Number of distinct stress amounts.
+    int                         StressMin = 0;
+    int                         StressMax = 0;
+    double                      Exponent = 0.0;                 // Slope of log(dt) over log(stress): ~1.0 for linear, ~2.0 for quadratic.
+    ImGuiPerfToolScalingModel   Model = ImGuiPerfToolScalingModel_Unknown;   // Best fitting model.
+    double                      ModelError = 0.0;               // RMS of relative residuals for best fitting model.
+    double                      PrevExponent = 0.0;             // Exponent of previous batch of the same test and build, if any.
+    bool                        ExponentChanged = false;        // Exponent moved by more than threshold since previous batch of the same build.
+};
+
 enum ImGuiPerfToolDisplayType : int
 {
     ImGuiPerfToolDisplayType_Simple,                            // Each run will be displayed individually.
@@ -100,6 +131,7 @@ struct IMGUI_API ImGuiPerfTool
     bool                        _PlotHoverTestLabel = false;
     bool                        _ReportGenerating = false;
     ImGuiStorage                _Visibility;
+    ImVector<ImGuiPerfToolScalingFit> _ScalingFits;             // Cached result of CalcScalingFits(), updated in _Rebuild().
     ImGuiCsvParser*             _CsvParser = NULL;              // We keep this around and point to its fields
 
     ImGuiPerfTool();
@@ -114,6 +146,7 @@ struct IMGUI_API ImGuiPerfTool
     void        ViewOnly(const char** perf_names);
     ImGuiPerfToolEntry* GetEntryByBatchIdx(int idx, const char* perf_name = NULL);
     bool        SaveHtmlReport(const char* file_name, const char* image_file = NULL);
+    void        CalcScalingFits(ImVector<ImGuiPerfToolScalingFit>* out_fits, double exponent_threshold = 0.3) const;
     inline bool Empty()         { return _SrcData.empty(); }
 
     void        _Rebuild();
@@ -123,9 +156,11 @@ struct IMGUI_API ImGuiPerfTool
     void        _CalculateLegendAlignment();
     void        _ShowEntriesPlot();
     void        _ShowEntriesTable();
+    void        _ShowScalingTable();
     void        _SetBaseline(int batch_index);
     void        _AddSettingsHandler();
     void        _UnpackSortedKey(ImU64 key, int* batch_index, int* entry_index, int* monotonic_index = NULL);
 };
 
 IMGUI_API void    ImGuiTestEngine_PerfToolAppendToCSV(ImGuiPerfTool* perf_log, ImGuiPerfToolEntry* entry, const char* filename = NULL);
+IMGUI_API const char* ImGuiTestEngine_PerfToolGetScalingModelName(ImGuiPerfToolScalingModel model);
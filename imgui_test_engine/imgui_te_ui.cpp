@@ -131,8 +131,9 @@ static void DrawTestLog(ImGuiTestEngine* e, ImGuiTest* test)
     const float dpi_scale = GetDpiScale();
 
     ImGuiTestLog* log = &test->TestLog;
-    const char* text = test->TestLog.Buffer.begin();
-    const char* text_end = test->TestLog.Buffer.end();
+    if (log->LinesTrimmed > 0)
+        ImGui::TextDisabled("(%d earlier lines trimmed)", log->LinesTrimmed);
+    ImGuiTextBuffer line_buf;
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(6.0f, 2.0f) * dpi_scale);
     ImGuiListClipper clipper;
     ImGuiTestVerboseLevel max_log_level = test->Status == ImGuiTestStatus_Error ? e->IO.ConfigVerboseLevelOnError : e->IO.ConfigVerboseLevel;
@@ -154,10 +155,11 @@ static void DrawTestLog(ImGuiTestEngine* e, ImGuiTest* test)
                 current_index_abs++;
             }
 
-            const char* line_start = text + line_info->LineOffset;
-            const char* line_end = strchr(line_start, '\n');
-            if (line_end == NULL)
-                line_end = text_end;
+            // Lines are formatted on demand: only visible ones are formatted.
+            line_buf.Buf.resize(0);
+            log->FormatLine(current_index_abs - 1, &line_buf);
+            const char* line_start = line_buf.begin();
+            const char* line_end = line_buf.end() - 1; // Strip trailing '\n'
 
             switch (line_info->Level)
             {
@@ -215,7 +217,7 @@ static void GetFailingTestsAsString(ImGuiTestEngine* e, ImGuiTestGroup group, ch
     for (int i = 0; i < e->TestsAll.Size; i++)
     {
         ImGuiTest* failing_test = e->TestsAll[i];
-        Str* filter = (group == ImGuiTestGroup_Tests) ? e->UiFilterTests : e->UiFilterPerfs;
+        Str* filter = (group == ImGuiTestGroup_Tests) ? e->UiFilterTests : (group == ImGuiTestGroup_Perfs) ? e->UiFilterPerfs : e->UiFilterMicroBenchs;
         if (failing_test->Group != group)
             continue;
         if (failing_test->Status != ImGuiTestStatus_Error)
@@ -300,10 +302,9 @@ static void ShowTestGroup(ImGuiTestEngine* e, ImGuiTestGroup group, Str* filter)
     float filter_width = ImGui::GetWindowContentRegionMax().x - ImGui::GetCursorPos().x;
     float perf_stress_factor_width = (30 * dpi_scale);
     if (group == ImGuiTestGroup_Perfs)
-    {
-        filter_width -= style.ItemSpacing.x + perf_stress_factor_width;
+        filter_width -= (style.ItemSpacing.x + perf_stress_factor_width) * 2;
+    if (group == ImGuiTestGroup_Perfs || group == ImGuiTestGroup_MicroBenchs)
         filter_width -= style.ItemSpacing.x + style.FramePadding.x * 2 + ImGui::CalcTextSize(perflog_label).x;
-    }
     filter_width -= ImGui::CalcTextSize("(?)").x + style.ItemSpacing.x;
     ImGui::SetNextItemWidth(ImMax(20.0f, filter_width));
     ImGui::InputText("##filter", filter);
@@ -319,6 +320,12 @@ static void ShowTestGroup(ImGuiTestEngine* e, ImGuiTestGroup group, Str* filter)
         ImGui::SameLine();
         ImGui::SetNextItemWidth(perf_stress_factor_width);
         ImGui::DragInt("##PerfStress", &e->IO.PerfStressAmount, 0.1f, 1, 20, "x%d"); HelpTooltip("Increase workload of performance tests (higher means longer run)."); // FIXME: Move?
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(perf_stress_factor_width);
+        ImGui::DragInt("##PerfStressSweep", &e->IO.PerfStressSweepMax, 0.1f, 0, 64, (e->IO.PerfStressSweepMax > 1) ? "..x%d" : "--"); HelpTooltip("Stress sweep: run each perf test at stress amounts x1, x2, x4... up to this value, to fit scaling curves in Perf Tool.");
+    }
+    if (group == ImGuiTestGroup_Perfs || group == ImGuiTestGroup_MicroBenchs)
+    {
         ImGui::SameLine();
         if (ImGui::Button(perflog_label))
         {
@@ -452,7 +459,7 @@ static void ShowTestGroup(ImGuiTestEngine* e, ImGuiTestGroup group, Str* filter)
                 if (ImGui::MenuItem("View source...", NULL, false, test->SourceFile != NULL))
                     view_source = true;
 
-                if (group == ImGuiTestGroup_Perfs && ImGui::MenuItem("View perflog"))
+                if ((group == ImGuiTestGroup_Perfs || group == ImGuiTestGroup_MicroBenchs) && ImGui::MenuItem("View perflog"))
                 {
                     e->PerfTool->ViewOnly(test->Name);
                     e->UiPerfToolOpen = true;
@@ -586,7 +593,11 @@ static void ImGuiTestEngine_ShowLogAndTools(ImGuiTestEngine* engine)
         ImGui::SameLine();
         if (ImGui::SmallButton("Copy to clipboard"))
             if (engine->UiSelectedTest)
-                ImGui::SetClipboardText(engine->UiSelectedTest->TestLog.Buffer.c_str());
+            {
+                ImGuiTextBuffer buffer;
+                engine->UiSelectedTest->TestLog.ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, ImGuiTestVerboseLevel_Trace, &buffer);
+                ImGui::SetClipboardText(buffer.c_str());
+            }
         ImGui::Separator();
 
         ImGui::BeginChild("Log");
@@ -621,6 +632,17 @@ static void ImGuiTestEngine_ShowLogAndTools(ImGuiTestEngine* engine)
         {
             ImGui::Checkbox("Capture when requested by API", &engine->IO.ConfigCaptureEnabled); HelpTooltip("Enable or disable screen capture API completely.");
             ImGui::Checkbox("Capture screen on error", &engine->IO.ConfigCaptureOnError); HelpTooltip("Capture a screenshot on test failure.");
+            ImGui::Checkbox("Update golden images", &engine->IO.ConfigCaptureUpdateGoldens); HelpTooltip("ctx->CaptureCompare() writes captures as new golden images instead of comparing them.");
+            ImGui::SetNextItemWidth(70 * dpi_scale);
+            ImGui::InputText("Screenshot format", engine->IO.ImageCaptureExtension, IM_ARRAYSIZE(engine->IO.ImageCaptureExtension)); HelpTooltip("File extension of screenshots: .png, or .qoi (lossless, much faster to save, larger files).");
+            ImGui::SetNextItemWidth(70 * dpi_scale);
+            ImGui::SliderInt("PNG compression level", &engine->IO.ImageCapturePngCompressionLevel, 1, 9); HelpTooltip("Lower is faster but produces larger files.");
+            ImGui::SetNextItemWidth(70 * dpi_scale);
+            const char* png_filter_names[] = { "All (smallest)", "None", "Sub", "Up", "Average", "Paeth" };
+            int png_filter_idx = ImClamp(engine->IO.ImageCapturePngFilter, -1, 4) + 1;
+            if (ImGui::Combo("PNG filter", &png_filter_idx, png_filter_names, IM_ARRAYSIZE(png_filter_names)))
+                engine->IO.ImageCapturePngFilter = png_filter_idx - 1;
+            HelpTooltip("Scanline filter. 'All' tries every filter for each scanline and keeps smallest output, which is slowest.");
 
             // Fields modified by in this call will be synced to engine->CaptureContext.
             engine->CaptureTool._ShowEncoderConfigFields(&engine->CaptureContext);
@@ -771,6 +793,11 @@ static void ImGuiTestEngine_ShowTestTool(ImGuiTestEngine* engine, bool* p_open)
             ShowTestGroup(engine, ImGuiTestGroup_Perfs, engine->UiFilterPerfs);
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("MICROBENCHS", NULL, ImGuiTabItemFlags_NoPushId))
+        {
+            ShowTestGroup(engine, ImGuiTestGroup_MicroBenchs, engine->UiFilterMicroBenchs);
+            ImGui::EndTabItem();
+        }
         ImGui::EndTabBar();
     }
     ImGui::EndChild();
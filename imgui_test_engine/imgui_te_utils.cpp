@@ -18,6 +18,7 @@
 #endif
 #include <shellapi.h>   // ShellExecuteA()
 #include <stdio.h>
+#include <io.h>         // _commit()
 #else
 #include <errno.h>
 #include <unistd.h>
@@ -30,7 +31,7 @@
 #if defined(__linux) || defined(__linux__) || defined(__MACH__) || defined(__MSL__) || defined(__MINGW32__)
 #include <pthread.h>    // pthread_setname_np()
 #endif
-#include <chrono>       // high_resolution_clock::now()
+#include <chrono>       // high_resolution_clock::now(), steady_clock::now()
 #include <thread>       // this_thread::sleep_for()
 
 //-----------------------------------------------------------------------------
@@ -228,6 +229,7 @@ const char* ImFindNextDecoratedPartInPath(const char* str, const char* str_end)
 // - ImFileCreateDirectoryChain()
 // - ImFileFindInParents()
 // - ImFileLoadSourceBlurb()
+// - ImFileSyncToDisk()
 //-----------------------------------------------------------------------------
 
 #if _WIN32
@@ -361,6 +363,17 @@ bool ImFileLoadSourceBlurb(const char* file_name, int line_no_start, int line_no
     return true;
 }
 
+bool ImFileSyncToDisk(FILE* fp)
+{
+    if (fflush(fp) != 0)
+        return false;
+#if _WIN32
+    return _commit(_fileno(fp)) == 0;
+#else
+    return fsync(fileno(fp)) == 0;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // Path Helpers
 //-----------------------------------------------------------------------------
@@ -511,6 +524,19 @@ void ImStrXmlEscape(Str* s)
     ImStrReplace(s, "\'", "&apos;");
 }
 
+// Escape for use inside a JSON string (without surrounding quotes).
+void ImStrJsonEscape(Str* s)
+{
+    ImStrReplace(s, "\\", "\\\\");
+    ImStrReplace(s, "\"", "\\\"");
+    ImStrReplace(s, "\n", "\\n");
+    ImStrReplace(s, "\r", "\\r");
+    ImStrReplace(s, "\t", "\\t");
+    for (char* p = s->c_str(); *p != 0; p++)
+        if ((unsigned char)*p < 0x20)
+            *p = ' ';   // Other control characters are unlikely, replace them instead of using \u00XX escapes.
+}
+
 // Based on code from https://github.com/EddieBreeg/C_b64 by @EddieBreeg.
 int ImStrBase64Encode(const unsigned char* src, char* dst, int length)
 {
@@ -645,6 +671,7 @@ bool    ImParseFindIniSection(const char* ini_config, const char* header, ImVect
 // Time Helpers
 //-----------------------------------------------------------------------------
 // - ImTimeGetInMicroseconds()
+// - ImTimeGetInNanoseconds()
 // - ImTimestampToISO8601()
 //-----------------------------------------------------------------------------
 
@@ -656,6 +683,17 @@ uint64_t ImTimeGetInMicroseconds()
     return (uint64_t)ms.count();
 }
 
+uint64_t ImTimeGetInNanoseconds()
+{
+    using namespace std;
+    chrono::nanoseconds ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch());
+    return (uint64_t)ns.count();
+}
+
+#if !defined(__GNUC__) && !defined(__clang__)
+volatile unsigned char GImDoNotOptimizeSink = 0;   // See ImDoNotOptimize()
+#endif
+
 void ImTimestampToISO8601(uint64_t timestamp, Str* out_date)
 {
     time_t unix_time = (time_t)(timestamp / 1000000); // Convert to seconds.
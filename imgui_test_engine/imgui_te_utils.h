@@ -40,6 +40,7 @@ bool        ImFileDelete(const char* filename);
 bool        ImFileCreateDirectoryChain(const char* path, const char* path_end = NULL);
 bool        ImFileFindInParents(const char* sub_path, int max_parent_count, Str* output);
 bool        ImFileLoadSourceBlurb(const char* filename, int line_no_start, int line_no_end, ImGuiTextBuffer* out_buf);
+bool        ImFileSyncToDisk(FILE* fp);     // Flush stdio buffers and ask OS to write file contents to storage device (fsync).
 
 //-----------------------------------------------------------------------------
 // Path Helpers
@@ -57,6 +58,7 @@ void        ImPathFixSeparatorsForCurrentOS(char* buf);
 void        ImStrReplace(Str* s, const char* find, const char* repl);
 const char* ImStrchrRangeWithEscaping(const char* str, const char* str_end, char find_c);
 void        ImStrXmlEscape(Str* s);
+void        ImStrJsonEscape(Str* s);
 int         ImStrBase64Encode(const unsigned char* src, char* dst, int length);
 
 //-----------------------------------------------------------------------------
@@ -71,6 +73,7 @@ bool        ImParseFindIniSection(const char* ini_config, const char* header, Im
 //-----------------------------------------------------------------------------
 
 uint64_t    ImTimeGetInMicroseconds();
+uint64_t    ImTimeGetInNanoseconds();                               // For micro-benchmarks. Only differences between two values are meaningful.
 void        ImTimestampToISO8601(uint64_t timestamp, Str* out_date);
 
 //-----------------------------------------------------------------------------
@@ -137,6 +140,29 @@ ImGuiID     TableGetHeaderID(ImGuiTable* table, const char* column, int instance
 ImGuiID     TableGetHeaderID(ImGuiTable* table, int column_n, int instance_no = 0);
 void        TableDiscardInstanceAndSettings(ImGuiID table_id);
 
+//-----------------------------------------------------------------------------
+// Helper: prevent compiler from optimizing away a value computed by a micro-benchmark kernel
+//-----------------------------------------------------------------------------
+
+#if !defined(__GNUC__) && !defined(__clang__)
+extern volatile unsigned char GImDoNotOptimizeSink;
+#endif
+
+template<typename TYPE>
+inline void ImDoNotOptimize(const TYPE& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    // No inline asm (MSVC x64): storing the address alone doesn't require the value to be computed, so read its bytes through volatile accesses.
+    const volatile unsigned char* bytes = (const volatile unsigned char*)&value;
+    unsigned char sink = 0;
+    for (size_t n = 0; n < sizeof(TYPE); n++)
+        sink ^= bytes[n];
+    GImDoNotOptimizeSink = sink;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // Helper: maintain/calculate moving average
 //-----------------------------------------------------------------------------
@@ -43,9 +43,11 @@
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "imgui.h"
 #include <stdio.h>
+#include <thread>
 #include "imgui_test_suite.h"
 #include "imgui_test_engine/imgui_te_engine.h"
 #include "imgui_test_engine/imgui_te_exporters.h"
+#include "imgui_test_engine/imgui_te_perftool.h"
 #include "imgui_test_engine/imgui_te_coroutine.h"
 #include "imgui_test_engine/imgui_te_utils.h"
 #include "imgui_test_engine/imgui_te_ui.h"
@@ -80,6 +82,7 @@ static void TestSuite_PrintCommandLineHelp();
 static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char** argv);
 static void TestSuite_QueueTests(TestSuiteApp* app);
 static void TestSuite_LoadFonts(float dpi_scale);
+static void TestSuite_PrintScalingReport();
 
 //-------------------------------------------------------------------------
 // Test Application
@@ -98,18 +101,32 @@ struct TestSuiteApp
     // Command-line options
     bool                        OptGui = false;
     bool                        OptGuiFunc = false;
+    bool                        OptSoftwareRenderer = false;
     ImGuiTestRunSpeed           OptRunSpeed = ImGuiTestRunSpeed_Fast;
     ImGuiTestVerboseLevel       OptVerboseLevelBasic = ImGuiTestVerboseLevel_COUNT; // Default is set in main.cpp depending on -gui/-nogui
     ImGuiTestVerboseLevel       OptVerboseLevelError = ImGuiTestVerboseLevel_COUNT; // "
     bool                        OptNoThrottle = false;
+    bool                        OptVirtualClock = false;
     bool                        OptPauseOnExit = true;
     bool                        OptViewports = false;
     bool                        OptMockViewports = false;
     bool                        OptCaptureEnabled = true;
+    bool                        OptUpdateGoldens = false;
+    bool                        OptConvertToPng = false;
+    Str16                       OptCaptureFormat;
+    int                         OptPngCompressionLevel = -1;
+    int                         OptCaptureThreads = 2;
     int                         OptStressAmount = 5;
+    int                         OptStressSweepMax = 0;
     Str128                      OptSourceFileOpener;
     Str128                      OptExportFilename;
     ImGuiTestEngineExportFormat OptExportFormat = ImGuiTestEngineExportFormat_JUnitXml;
+    Str128                      OptExportStreamFilename;
+    float                       OptExportStreamSyncInterval = -1.0f;
+    Str128                      OptExportMergeFilename;
+    int                         OptStartupBenchIterations = 0;
+    Str16                       OptStartupBenchFonts = "suite";
+    int                         OptStartupBenchIniWindows = 100;
     ImVector<char*>             TestsToRun;
 };
 
@@ -167,16 +184,31 @@ static void TestSuite_PrintCommandLineHelp()
     printf("  -ve0/-ve1/-ve2/-ve3/-ve4 : verbose level for errored tests [same as above]\n");
     printf("  -gui/-nogui              : enable gui/interactive mode.\n");
     printf("  -guifunc                 : run test GuiFunc only (no TestFunc).\n");
+    printf("  -softwarerenderer        : render with CPU rasterizer when not using gui mode (screen captures work without GPU).\n");
     printf("  -slow                    : run automation at feeble human speed.\n");
     printf("  -nothrottle              : run GUI app without throttling/vsync by default.\n");
+    printf("  -virtualclock            : run tests with a virtual clock (fixed delta time, no wall clock waits).\n");
     printf("  -nopause                 : don't pause application on exit.\n");
     printf("  -nocapture               : don't capture any images or video.\n");
+    printf("  -updategoldens           : write golden images instead of comparing captures with them.\n");
+    printf("  -capture-format <format> : save screenshots in specified format: png, qoi (fast, larger files), bmp, tga. (default: png)\n");
+    printf("  -png-level <int>         : set PNG compression level, 1 (fastest) to 9 (smallest). (default: 8)\n");
+    printf("  -capture-threads <int>   : set number of background threads writing captures, 0 to write synchronously. (default: 2)\n");
+    printf("  -topng <files...>        : convert image files (e.g. .qoi captures) to .png next to them, then exit.\n");
     printf("  -stressamount <int>      : set performance test duration multiplier (default: 5)\n");
+    printf("  -stresssweep <int>       : run perf tests at stress amounts 1, 2, 4... up to <int>, then print fitted scaling curves.\n");
     printf("  -fileopener <file>       : provide a bat/cmd/shell script to open source file.\n");
     printf("  -export-file <file>      : save test run results in specified file.\n");
-    printf("  -export-format <format>   : save test run results in specified format. (default: junit)\n");
+    printf("  -export-format <format>   : save test run results in specified format: junit, jsonl, json. (default: junit)\n");
+    printf("  -export-stream <file>    : append results to specified file as soon as each test completes (.xml: junit fragments, otherwise jsonl).\n");
+    printf("  -export-stream-sync <s>  : sync stream file to disk at most every <s> seconds. (default: 5)\n");
+    printf("  -export-merge <file> <streams...> : merge stream files into a results file (.xml: junit, otherwise jsonl), then exit.\n");
+    printf("  -startup-bench <int>     : create/destroy contexts <int> times, log time of each startup phase to perf log, then exit.\n");
+    printf("  -startup-fonts <set>     : font set loaded by startup benchmark: default, suite, all. (default: suite)\n");
+    printf("  -startup-ini <int>       : number of windows in .ini data loaded by startup benchmark. (default: 100)\n");
     printf("Tests:\n");
     printf("   all/tests/perf          : queue by groups: all, only tests, only performance benchmarks.\n");
+    printf("   microbenchs             : queue microbenchmarks group (also included in 'all').\n");
     printf("   [pattern]               : queue all tests containing the word [pattern].\n");
     printf("   [-pattern]              : queue all tests not containing the word [pattern].\n");
     printf("   [^pattern]              : queue all tests starting with the word [pattern].\n");
@@ -214,11 +246,40 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
         else if (strcmp(argv[n], "-gui") == 0)          { app->OptGui = true; }
         else if (strcmp(argv[n], "-nogui") == 0)        { app->OptGui = false; }
         else if (strcmp(argv[n], "-guifunc") == 0)      { app->OptGuiFunc = true; }
+        else if (strcmp(argv[n], "-softwarerenderer") == 0) { app->OptSoftwareRenderer = true; }
         else if (strcmp(argv[n], "-fast") == 0)         { app->OptRunSpeed = ImGuiTestRunSpeed_Fast; app->OptNoThrottle = true; }
         else if (strcmp(argv[n], "-slow") == 0)         { app->OptRunSpeed = ImGuiTestRunSpeed_Normal; app->OptNoThrottle = false; }
         else if (strcmp(argv[n], "-nothrottle") == 0)   { app->OptNoThrottle = true; }
+        else if (strcmp(argv[n], "-virtualclock") == 0) { app->OptVirtualClock = true; }
         else if (strcmp(argv[n], "-nopause") == 0)      { app->OptPauseOnExit = false; }
         else if (strcmp(argv[n], "-nocapture") == 0)    { app->OptCaptureEnabled = false; }
+        else if (strcmp(argv[n], "-updategoldens") == 0){ app->OptUpdateGoldens = true; }
+        else if (strcmp(argv[n], "-topng") == 0)        { app->OptConvertToPng = true; }
+        else if (strcmp(argv[n], "-capture-format") == 0 && n + 1 < argc)
+        {
+            const char* format = (argv[n + 1][0] == '.') ? argv[n + 1] + 1 : argv[n + 1];
+            if (strcmp(format, "png") == 0 || strcmp(format, "qoi") == 0 || strcmp(format, "bmp") == 0 || strcmp(format, "tga") == 0)
+            {
+                app->OptCaptureFormat.setf(".%s", format);
+            }
+            else
+            {
+                fprintf(stderr, "Unknown value '%s' passed to '-capture-format'.\n", argv[n + 1]);
+                fprintf(stderr, "Possible values: png, qoi, bmp, tga\n");
+                return false;
+            }
+            n++;
+        }
+        else if (strcmp(argv[n], "-png-level") == 0 && n + 1 < argc)
+        {
+            app->OptPngCompressionLevel = ImClamp(atoi(argv[n + 1]), 1, 9);
+            n++;
+        }
+        else if (strcmp(argv[n], "-capture-threads") == 0 && n + 1 < argc)
+        {
+            app->OptCaptureThreads = ImMax(atoi(argv[n + 1]), 0);
+            n++;
+        }
         else if (strcmp(argv[n], "-viewport") == 0)     { app->OptViewports = true; }
         else if (strcmp(argv[n], "-viewport-mock") == 0){ app->OptViewports = app->OptMockViewports = true; }
         else if (strcmp(argv[n], "-stressamount") == 0 && n + 1 < argc)
@@ -226,6 +287,11 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
             app->OptStressAmount = atoi(argv[n + 1]);
             n++;
         }
+        else if (strcmp(argv[n], "-stresssweep") == 0 && n + 1 < argc)
+        {
+            app->OptStressSweepMax = atoi(argv[n + 1]);
+            n++;
+        }
         else if (strcmp(argv[n], "-fileopener") == 0 && n + 1 < argc)
         {
             app->OptSourceFileOpener = argv[n + 1];
@@ -238,17 +304,66 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
             {
                 app->OptExportFormat = ImGuiTestEngineExportFormat_JUnitXml;
             }
+            else if (strcmp(argv[n + 1], "jsonl") == 0)
+            {
+                app->OptExportFormat = ImGuiTestEngineExportFormat_JsonLines;
+            }
+            else if (strcmp(argv[n + 1], "json") == 0)
+            {
+                app->OptExportFormat = ImGuiTestEngineExportFormat_Json;
+            }
             else
             {
                 fprintf(stderr, "Unknown value '%s' passed to '-export-format'.", argv[n + 1]);
                 fprintf(stderr, "Possible values:\n");
                 fprintf(stderr, "- junit\n");
+                fprintf(stderr, "- jsonl\n");
+                fprintf(stderr, "- json\n");
             }
         }
         else if (strcmp(argv[n], "-export-file") == 0 && n + 1 < argc)
         {
             app->OptExportFilename = argv[n + 1];
         }
+        else if (strcmp(argv[n], "-export-stream") == 0 && n + 1 < argc)
+        {
+            app->OptExportStreamFilename = argv[n + 1];
+            n++;
+        }
+        else if (strcmp(argv[n], "-export-stream-sync") == 0 && n + 1 < argc)
+        {
+            app->OptExportStreamSyncInterval = (float)atof(argv[n + 1]);
+            n++;
+        }
+        else if (strcmp(argv[n], "-export-merge") == 0 && n + 1 < argc)
+        {
+            app->OptExportMergeFilename = argv[n + 1];
+            n++;
+        }
+        else if (strcmp(argv[n], "-startup-bench") == 0 && n + 1 < argc)
+        {
+            app->OptStartupBenchIterations = ImMax(atoi(argv[n + 1]), 1);
+            n++;
+        }
+        else if (strcmp(argv[n], "-startup-fonts") == 0 && n + 1 < argc)
+        {
+            if (strcmp(argv[n + 1], "default") == 0 || strcmp(argv[n + 1], "suite") == 0 || strcmp(argv[n + 1], "all") == 0)
+            {
+                app->OptStartupBenchFonts = argv[n + 1];
+            }
+            else
+            {
+                fprintf(stderr, "Unknown value '%s' passed to '-startup-fonts'.\n", argv[n + 1]);
+                fprintf(stderr, "Possible values: default, suite, all\n");
+                return false;
+            }
+            n++;
+        }
+        else if (strcmp(argv[n], "-startup-ini") == 0 && n + 1 < argc)
+        {
+            app->OptStartupBenchIniWindows = ImMax(atoi(argv[n + 1]), 0);
+            n++;
+        }
         else
         {
             printf("Syntax: %s <options> [tests...]\n", argv[0]);
@@ -281,9 +396,39 @@ enum ImGuiTestAppErrorCode
 {
     ImGuiTestAppErrorCode_Success = 0,
     ImGuiTestAppErrorCode_CommandLineError = 1,
-    ImGuiTestAppErrorCode_TestFailed = 2
+    ImGuiTestAppErrorCode_TestFailed = 2,
+    ImGuiTestAppErrorCode_ConvertFailed = 3
 };
 
+// Print scaling curves fitted over the whole perf log, for the latest batch of each test and build.
+static void TestSuite_PrintScalingReport()
+{
+    ImGuiPerfTool perftool;
+    if (!perftool.LoadCSV())
+        return;
+    ImVector<ImGuiPerfToolScalingFit> fits;
+    perftool.CalcScalingFits(&fits);
+
+    printf("\nScaling curves:\n");
+    int count_changed = 0;
+    for (int n = 0; n < fits.Size; n++)
+    {
+        const ImGuiPerfToolScalingFit& fit = fits[n];
+        if (n + 1 < fits.Size && strcmp(fits[n + 1].TestName, fit.TestName) == 0 && fits[n + 1].BuildID == fit.BuildID)
+            continue; // Fits are ordered by batch timestamp within a build, only print latest
+        printf("- %-40s %s %s x%d..x%d: exponent %.2f, %s (error %.1f%%)", fit.TestName, fit.GitBranchName, fit.BuildType, fit.StressMin, fit.StressMax, fit.Exponent, ImGuiTestEngine_PerfToolGetScalingModelName(fit.Model), fit.ModelError * 100.0);
+        if (fit.ExponentChanged)
+        {
+            ImOsConsoleSetTextColor(ImOsConsoleStream_StandardOutput, ImOsConsoleTextColor_BrightRed);
+            printf(" CHANGED from %.2f", fit.PrevExponent);
+            ImOsConsoleSetTextColor(ImOsConsoleStream_StandardOutput, ImOsConsoleTextColor_White);
+            count_changed++;
+        }
+        printf("\n");
+    }
+    printf("(%d tests changed scaling exponent since previous run of same build)\n", count_changed);
+}
+
 static void TestSuite_LoadFonts(float dpi_scale)
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -323,7 +468,7 @@ static void TestSuite_QueueTests(TestSuiteApp* app)
     if (app->OptGuiFunc)
         run_flags |= ImGuiTestRunFlags_GuiFuncOnly;
 
-    // Special groups are supported by ImGuiTestEngine_QueueTests(): "all", "tests", "perfs"
+    // Special groups are supported by ImGuiTestEngine_QueueTests(): "all", "tests", "perfs", "microbenchs"
     // Following command line examples are functionally identical:
     //  ./imgui_test_suite tests,-window
     //  ./imgui_test_suite -- tests -window
@@ -361,6 +506,214 @@ static void FindVideoEncoder(char* out, int out_len)
         *out = 0;
 }
 
+// Convert image files listed on command-line (e.g. .qoi captures from a fast run) to PNG for publishing.
+static ImGuiTestAppErrorCode TestSuite_ConvertImageFilesToPng(TestSuiteApp* app)
+{
+    ImGuiCaptureContext capture_context;
+    capture_context.ImageWriterThreads = ImMax((int)std::thread::hardware_concurrency(), 1);
+    capture_context.ImageWriterQueueSize = capture_context.ImageWriterThreads * 2;
+    if (app->OptPngCompressionLevel != -1)
+        capture_context.PngCompressionLevel = app->OptPngCompressionLevel;
+    capture_context.ConvertImageFilesToPng(app->TestsToRun.Data, app->TestsToRun.Size);
+    capture_context.ShutdownImageWriter();
+
+    int failed_count = 0;
+    ImGuiCaptureImageWriterResult result;
+    while (capture_context.PollImageWriterResult(&result))
+    {
+        if (result.Success)
+            printf("Wrote '%s' (%.1f ms)\n", result.Filename, result.DurationMs);
+        else
+            fprintf(stderr, "Error converting '%s'\n", result.Filename);
+        failed_count += result.Success ? 0 : 1;
+    }
+    for (char* filename : app->TestsToRun)
+        IM_FREE(filename);
+    app->TestsToRun.clear();
+    return (failed_count > 0) ? ImGuiTestAppErrorCode_ConvertFailed : ImGuiTestAppErrorCode_Success;
+}
+
+// Merge result stream files listed on command-line (e.g. from parallel or crashed runs) into a regular results file.
+static ImGuiTestAppErrorCode TestSuite_ExportMergeStreams(TestSuiteApp* app)
+{
+    const bool is_xml = ImStricmp(ImPathFindExtension(app->OptExportMergeFilename.c_str()), ".xml") == 0;
+    const ImGuiTestEngineExportFormat format = is_xml ? ImGuiTestEngineExportFormat_JUnitXml : ImGuiTestEngineExportFormat_JsonLines;
+    bool ret = ImGuiTestEngine_ExportStreamMerge(app->TestsToRun.Data, app->TestsToRun.Size, format, app->OptExportMergeFilename.c_str());
+    for (char* filename : app->TestsToRun)
+        IM_FREE(filename);
+    app->TestsToRun.clear();
+    return ret ? ImGuiTestAppErrorCode_Success : ImGuiTestAppErrorCode_CommandLineError;
+}
+
+static bool TestSuite_FindGitBranchName(Str* out)
+{
+    Str64 git_repo_path;
+    if (ImFileFindInParents("imgui/", 4, &git_repo_path))
+        return ImBuildFindGitBranchName(git_repo_path.c_str(), out);
+    return false;
+}
+
+// Load one of the font sets used by startup benchmark ("default", "suite", "all") and build atlas.
+static void TestSuite_LoadStartupBenchFonts(const char* font_set)
+{
+    if (strcmp(font_set, "suite") == 0)
+    {
+        TestSuite_LoadFonts(1.0f);
+        return;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts->AddFontDefault();
+    Str64 base_font_dir;
+    if (strcmp(font_set, "all") == 0 && ImFileFindInParents("imgui_test_suite/assets/fonts/", 3, &base_font_dir))
+    {
+        const char* font_files[] = { "NotoSans-Regular.ttf", "NotoSansMono-Regular.ttf", "Roboto-Medium.ttf" };
+        const float font_sizes[] = { 13.0f, 16.0f, 24.0f };
+        for (const char* font_file : font_files)
+            for (float font_size : font_sizes)
+                io.Fonts->AddFontFromFileTTF(Str64f("%s/%s", base_font_dir.c_str(), font_file).c_str(), font_size);
+    }
+    io.Fonts->Build();
+}
+
+// Generate .ini data with windows, tables, dock nodes and test engine/perf tool sections.
+static void TestSuite_BuildStartupBenchIni(ImGuiTextBuffer* buf, int windows_count)
+{
+    const ImGuiID dock_id_base = 0xD0C00000; // Odd windows are each docked in a floating node
+    for (int n = 0; n < windows_count; n++)
+    {
+        const ImGuiID window_id = ImHashStr(Str16f("Window %d", n).c_str());
+        buf->appendf("[Window][Window %d]\nPos=%d,%d\nSize=300,200\nCollapsed=0\n", n, 20 + (n % 40) * 20, 20 + (n % 30) * 20);
+#ifdef IMGUI_HAS_DOCK
+        if (n & 1)
+            buf->appendf("DockId=0x%08X,0\n", dock_id_base + n);
+#endif
+        buf->append("\n");
+        if ((n % 4) == 0)
+        {
+            buf->appendf("[Table][0x%08X,4]\n", ImHashStr("table", 0, window_id));
+            buf->append("Column 0  Weight=1.0000 Sort=0v\nColumn 1  Width=80\nColumn 2  Width=80 Visible=0\nColumn 3  Weight=1.0000\n\n");
+        }
+    }
+#ifdef IMGUI_HAS_DOCK
+    buf->append("[Docking][Data]\n");
+    for (int n = 1; n < windows_count; n += 2)
+        buf->appendf("DockNode ID=0x%08X Pos=%d,%d Size=300,200 Selected=0x%08X\n", dock_id_base + n, 20 + (n % 40) * 20, 20 + (n % 30) * 20, ImHashStr(Str16f("Window %d", n).c_str()));
+    buf->append("\n");
+#endif
+    buf->append("[TestEngine][Data]\nFilterTests=\nFilterPerfs=\nLogHeight=150\nCaptureTool=0\nPerfTool=0\nStackTool=0\n\n");
+    buf->append("[TestEnginePerfTool][Data]\nDateFrom=2020-01-01\nDateTo=2030-01-01\nDisplayType=0\n");
+    for (int n = 0; n < windows_count; n++)
+        buf->appendf("TestVisibility=perf_test_%d,1\n", n);
+    buf->append("\n");
+}
+
+// Startup benchmark: repeatedly create a context, load fonts and .ini data, submit a first frame, reboot and destroy.
+// Average time of each phase is appended to the perf log, under the "startup" category.
+static ImGuiTestAppErrorCode TestSuite_RunStartupBenchmark(TestSuiteApp* app)
+{
+    enum StartupPhase
+    {
+        StartupPhase_CreateContext,
+        StartupPhase_FontAtlas,
+        StartupPhase_EngineStart,
+        StartupPhase_IniLoad,
+        StartupPhase_FirstFrame,
+        StartupPhase_RebootContext,
+        StartupPhase_Shutdown,
+        StartupPhase_COUNT
+    };
+    Str64 phase_names[StartupPhase_COUNT];
+    phase_names[StartupPhase_CreateContext].set("startup_create_context");
+    phase_names[StartupPhase_FontAtlas].setf("startup_font_atlas_%s", app->OptStartupBenchFonts.c_str());
+    phase_names[StartupPhase_EngineStart].set("startup_engine_start");
+    phase_names[StartupPhase_IniLoad].setf("startup_ini_load_%d", app->OptStartupBenchIniWindows);
+    phase_names[StartupPhase_FirstFrame].set("startup_first_frame");
+    phase_names[StartupPhase_RebootContext].set("startup_reboot_context");
+    phase_names[StartupPhase_Shutdown].set("startup_shutdown");
+
+    ImGuiTextBuffer ini;
+    TestSuite_BuildStartupBenchIni(&ini, app->OptStartupBenchIniWindows);
+
+    double phase_total_ms[StartupPhase_COUNT] = {};
+    double phase_min_ms[StartupPhase_COUNT];
+    for (double& v : phase_min_ms)
+        v = DBL_MAX;
+    uint64_t time_start = 0;
+    auto phase_end = [&](int phase)
+    {
+        const uint64_t time_end = ImTimeGetInMicroseconds();
+        const double ms = (double)(time_end - time_start) / 1000.0;
+        phase_total_ms[phase] += ms;
+        phase_min_ms[phase] = ImMin(phase_min_ms[phase], ms);
+        time_start = ImTimeGetInMicroseconds();
+    };
+
+    for (int iteration = 0; iteration < app->OptStartupBenchIterations; iteration++)
+    {
+        time_start = ImTimeGetInMicroseconds();
+        ImGui::CreateContext();
+        phase_end(StartupPhase_CreateContext);
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1440, 900);
+        io.DeltaTime = 1.0f / 60.0f;
+#ifdef IMGUI_HAS_DOCK
+        io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+#endif
+        time_start = ImTimeGetInMicroseconds();
+        TestSuite_LoadStartupBenchFonts(app->OptStartupBenchFonts.c_str());
+        phase_end(StartupPhase_FontAtlas);
+
+        ImGuiTestEngine* engine = ImGuiTestEngine_CreateContext();
+        ImGuiTestEngine_Start(engine, ImGui::GetCurrentContext());
+        phase_end(StartupPhase_EngineStart);
+
+        ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+        phase_end(StartupPhase_IniLoad);
+
+        app->TestEngine = engine;
+        ImGui::NewFrame();
+        TestSuite_ShowUI(app);
+        ImGui::Render();
+        phase_end(StartupPhase_FirstFrame);
+
+        ImGuiTestEngine_RebootUiContext(engine);
+        phase_end(StartupPhase_RebootContext);
+
+        ImGuiTestEngine_Stop(engine);
+        ImGui::DestroyContext();
+        ImGuiTestEngine_DestroyContext(engine);
+        app->TestEngine = NULL;
+        phase_end(StartupPhase_Shutdown);
+    }
+
+    // Append averages to perf log
+    Str64 git_branch("unknown");
+    TestSuite_FindGitBranchName(&git_branch);
+    const ImBuildInfo* build_info = ImBuildGetCompilationInfo();
+    printf("Startup benchmark: %d iterations, fonts '%s', %d windows in .ini\n", app->OptStartupBenchIterations, app->OptStartupBenchFonts.c_str(), app->OptStartupBenchIniWindows);
+    ImGuiPerfToolEntry entry;
+    entry.Timestamp = ImTimeGetInMicroseconds();
+    entry.Category = "startup";
+    entry.PerfStressAmount = 1;
+    entry.GitBranchName = git_branch.c_str();
+    entry.BuildType = build_info->Type;
+    entry.Cpu = build_info->Cpu;
+    entry.OS = build_info->OS;
+    entry.Compiler = build_info->Compiler;
+    entry.Date = build_info->Date;
+    for (int phase = 0; phase < StartupPhase_COUNT; phase++)
+    {
+        entry.TestName = phase_names[phase].c_str();
+        entry.DtDeltaMs = phase_total_ms[phase] / app->OptStartupBenchIterations;
+        printf("- %-32s avg %8.3f ms, min %8.3f ms\n", entry.TestName, entry.DtDeltaMs, phase_min_ms[phase]);
+        ImGuiTestEngine_PerfToolAppendToCSV(NULL, &entry);
+    }
+    return ImGuiTestAppErrorCode_Success;
+}
+
 // Win32 Debug CRT to help catch leaks. Replace parameter in main() to track a given allocation from the ID given in leak report.
 #ifdef DEBUG_CRT
 static inline void DebugCrtInit(long break_alloc)
@@ -410,6 +763,14 @@ int main(int argc, char** argv)
     }
     argv = NULL;
 
+    // Batch convert images and exit
+    if (app->OptConvertToPng)
+        return TestSuite_ConvertImageFilesToPng(app);
+
+    // Merge streamed results and exit
+    if (!app->OptExportMergeFilename.empty())
+        return TestSuite_ExportMergeStreams(app);
+
     // Default verbose levels differs whether we are in in GUI or Command-Line mode
     if (app->OptGui)
     {
@@ -432,6 +793,11 @@ int main(int argc, char** argv)
     // (We use a custom allocator but mostly to exercise that overriding)
     IMGUI_CHECKVERSION();
     ImGui::SetAllocatorFunctions(&MallocWrapper, &FreeWrapper, app);
+
+    // Run startup benchmark and exit
+    if (app->OptStartupBenchIterations > 0)
+        return TestSuite_RunStartupBenchmark(app);
+
     ImGui::CreateContext();
 #if IMGUI_TEST_ENGINE_ENABLE_IMPLOT
     ImPlot::CreateContext();
@@ -454,7 +820,7 @@ int main(int argc, char** argv)
     if (app->OptGui)
         app->AppWindow = ImGuiApp_ImplDefault_Create();
     if (app->AppWindow == NULL)
-        app->AppWindow = ImGuiApp_ImplNull_Create();
+        app->AppWindow = app->OptSoftwareRenderer ? ImGuiApp_ImplSoftware_Create() : ImGuiApp_ImplNull_Create();
     app->AppWindow->DpiAware = false;
     app->AppWindow->MockViewports = app->OptViewports && app->OptMockViewports;
 
@@ -469,8 +835,16 @@ int main(int argc, char** argv)
     test_io.ConfigVerboseLevel = app->OptVerboseLevelBasic;
     test_io.ConfigVerboseLevelOnError = app->OptVerboseLevelError;
     test_io.ConfigNoThrottle = app->OptNoThrottle;
+    test_io.ConfigVirtualClock = app->OptVirtualClock;
     test_io.PerfStressAmount = app->OptStressAmount;
+    test_io.PerfStressSweepMax = app->OptStressSweepMax;
     test_io.ConfigCaptureEnabled = app->OptCaptureEnabled;
+    test_io.ConfigCaptureUpdateGoldens = app->OptUpdateGoldens;
+    if (!app->OptCaptureFormat.empty())
+        ImStrncpy(test_io.ImageCaptureExtension, app->OptCaptureFormat.c_str(), IM_ARRAYSIZE(test_io.ImageCaptureExtension));
+    if (app->OptPngCompressionLevel != -1)
+        test_io.ImageCapturePngCompressionLevel = app->OptPngCompressionLevel;
+    test_io.ConfigCaptureWriterThreads = app->OptCaptureThreads;
     FindVideoEncoder(test_io.VideoCaptureEncoderPath, IM_ARRAYSIZE(test_io.VideoCaptureEncoderPath));
     ImStrncpy(test_io.VideoCaptureEncoderParams, IMGUI_CAPTURE_DEFAULT_VIDEO_PARAMS_FOR_FFMPEG, IM_ARRAYSIZE(test_io.VideoCaptureEncoderParams));
     ImStrncpy(test_io.GifCaptureEncoderParams, IMGUI_CAPTURE_DEFAULT_GIF_PARAMS_FOR_FFMPEG, IM_ARRAYSIZE(test_io.GifCaptureEncoderParams));
@@ -514,6 +888,14 @@ int main(int argc, char** argv)
             fprintf(stderr, "-junit-xml parameter is ignored in interactive runs.");
         }
     }
+    if (!app->OptExportStreamFilename.empty())
+    {
+        const bool is_xml = ImStricmp(ImPathFindExtension(app->OptExportStreamFilename.c_str()), ".xml") == 0;
+        test_io.ExportResultsStreamFilename = app->OptExportStreamFilename.c_str();
+        test_io.ExportResultsStreamFormat = is_xml ? ImGuiTestEngineExportFormat_JUnitXml : ImGuiTestEngineExportFormat_JsonLines;
+        if (app->OptExportStreamSyncInterval >= 0.0f)
+            test_io.ExportResultsStreamSyncInterval = app->OptExportStreamSyncInterval;
+    }
 
     // Create Application Window, Initialize Backends
     ImGuiApp* app_window = app->AppWindow;
@@ -526,11 +908,9 @@ int main(int argc, char** argv)
     const bool exit_after_tests = !ImGuiTestEngine_IsTestQueueEmpty(engine) && !app->OptPauseOnExit;
 
     // Retrieve Git branch name, store in annotation field by default
-    Str64 git_repo_path;
     Str64 git_branch;
-    if (ImFileFindInParents("imgui/", 4, &git_repo_path))
-        if (ImBuildFindGitBranchName(git_repo_path.c_str(), &git_branch))
-            strncpy(test_io.GitBranchName, git_branch.c_str(), IM_ARRAYSIZE(test_io.GitBranchName));
+    if (TestSuite_FindGitBranchName(&git_branch))
+        strncpy(test_io.GitBranchName, git_branch.c_str(), IM_ARRAYSIZE(test_io.GitBranchName));
     if (!test_io.GitBranchName[0])
     {
         strcpy(test_io.GitBranchName, "unknown");
@@ -554,6 +934,7 @@ int main(int argc, char** argv)
     {
         // Backend update
         // (stop updating them once we started aborting, as e.g. closed windows will have zero size etc.)
+        app_window->FixedDeltaTime = ImGuiTestEngine_IsUsingVirtualClock(engine) ? 1.0f / 60.0f : 0.0f;
         if (!aborted && !app_window->NewFrame(app_window))
             aborted = true;
 
@@ -599,6 +980,8 @@ int main(int argc, char** argv)
         ImGuiTestEngine_PrintResultSummary(engine);
         if (count_tested != count_success)
             error_code = ImGuiTestAppErrorCode_TestFailed;
+        if (app->OptStressSweepMax > 1)
+            TestSuite_PrintScalingReport();
     }
 
     // Shutdown Application Window
@@ -9,6 +9,7 @@
 #include "imgui_test_suite.h"
 #include "imgui_test_engine/imgui_te_engine.h"      // IM_REGISTER_TEST()
 #include "imgui_test_engine/imgui_te_context.h"
+#include "imgui_test_engine/imgui_te_exporters.h"  // ImGuiTestEngine_ExportStreamMerge()
 #include "imgui_test_engine/imgui_te_utils.h"       // ImHashDecoratedPath()
 #include "imgui_test_engine/imgui_capture_tool.h"
 #include "imgui_test_engine/thirdparty/Str/Str.h"
@@ -4240,6 +4241,10 @@ void RegisterTests_Misc(ImGuiTestEngine* e)
         ImStrXmlEscape(&text);
         IM_CHECK_STR_EQ(text.c_str(), "&amp;&amp;&lt;&gt;&quot;&apos;");
 
+        text.set("a\"b\\c\nd\te\x01");
+        ImStrJsonEscape(&text);
+        IM_CHECK_STR_EQ(text.c_str(), "a\\\"b\\\\c\\nd\\te ");
+
         // No recursive replacement.
         text.set("rerepeapeating rerepeapeating");
         ImStrReplace(&text, "repea", "");
@@ -5738,17 +5743,910 @@ void RegisterTests_TestEngine(ImGuiTestEngine* e)
         }
     };
 
+    // ## Test ImGuiTestItemList filters (status flags, depth, window) and chaining them
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_gather_filter");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Checkbox("Check1", &ctx->GenericVars.Bool1);
+        ImGui::Checkbox("Check2", &ctx->GenericVars.Bool2);
+        ImGui::BeginChild("Child", ImVec2(100, 100), true);
+        ImGui::Button("Button1");
+        ImGui::Checkbox("Check3", &ctx->GenericVars.Bool1);
+        ImGui::EndChild();
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ctx->GenericVars.Bool1 = true;
+        ctx->GenericVars.Bool2 = false;
+
+        ImGuiTestItemList items;
+        ctx->GatherItems(&items, "//Test Window", 2);
+        ctx->LogItemList(&items);
+        ImGuiWindow* child_window = ctx->WindowInfo("//Test Window/Child")->Window;
+        IM_CHECK(child_window != NULL);
+
+        ImVector<int> indices;
+        IM_CHECK_EQ(items.FilterByStatusFlags(&indices, ImGuiItemStatusFlags_Checkable), 3);
+        IM_CHECK_EQ(items.FilterByStatusFlags(&indices, ImGuiItemStatusFlags_Checkable | ImGuiItemStatusFlags_Checked), 2);
+        IM_CHECK_EQ(items.FilterByWindow(&indices, child_window, &indices), 1);
+        IM_CHECK_STR_EQ(items.GetLabel(indices[0]), "Check3");
+        IM_CHECK_EQ(items.GetByIndex(indices[0])->ID, ctx->GetID("//Test Window/Child/Check3"));
+
+        IM_CHECK_EQ(items.FilterByWindow(&indices, child_window), 2);
+        IM_CHECK_EQ(items.FilterByDepth(&indices, 0, 0), items.FilterByWindow(&indices, ctx->GetWindowByRef("//Test Window")));
+        IM_CHECK_EQ(items.FilterByDepth(&indices, 1, items.DepthMax), 2);
+        IM_CHECK(items.GetByID(ctx->GetID("//Test Window/Check2")) != NULL);
+        IM_CHECK(items.GetByID(ctx->GetID("//Test Window/Unknown")) == NULL);
+
+        // Labels submitted again for the same item: kept when unchanged, updated when changed
+        const int n = items.GetIndexByID(ctx->GetID("//Test Window/Check2"));
+        const int labels_buf_size = items.LabelsBuf.Size;
+        items.SetLabel(n, "Check2");
+        IM_CHECK_EQ(items.LabelsBuf.Size, labels_buf_size);
+        items.SetLabel(n, "Chk");
+        IM_CHECK_STR_EQ(items.GetLabel(n), "Chk");
+        IM_CHECK_EQ(items.LabelsBuf.Size, labels_buf_size);
+        items.SetLabel(n, "Check2 (changed)");
+        IM_CHECK_STR_EQ(items.GetLabel(n), "Check2 (changed)");
+        IM_CHECK_STR_EQ(items.GetByIndex(n)->DebugLabel, "Check2 (changed)");
+
+        // Labels shrinking and growing again reuse the slot: buffer only grows once per item
+        const int labels_buf_size_grown = items.LabelsBuf.Size;
+        IM_CHECK_GT(labels_buf_size_grown, labels_buf_size);
+        for (int i = 0; i < 10; i++)
+        {
+            items.SetLabel(n, "C");
+            items.SetLabel(n, "Check2 (changed again, with a label longer than DebugLabel[])");
+        }
+        IM_CHECK_EQ(items.LabelsBuf.Size, labels_buf_size_grown);
+        IM_CHECK_EQ((int)strlen(items.GetLabel(n)), IM_ARRAYSIZE(ImGuiTestItemInfo::DebugLabel) - 1);
+        IM_CHECK_STR_EQ(items.GetLabel(items.GetIndexByID(ctx->GetID("//Test Window/Check1"))), "Check1");
+    };
+
+    // ## Test input bursts: same results as regular inputs, in less frames
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_input_burst");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GenericVars;
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::InputText("InputText", vars.Str1, IM_ARRAYSIZE(vars.Str1));
+        if (ImGui::Button("Button"))
+            vars.Count++;
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GenericVars;
+        ctx->SetRef("Test Window");
+        int frame_count_text_regular = 0;
+        for (int variant = 0; variant < 2; variant++)
+        {
+            ctx->LogDebug("Variant: %s", variant ? "burst" : "regular");
+            strcpy(vars.Str1, "");
+            vars.Count = 0;
+            ctx->ItemClick("InputText");
+
+            const int frame_count_start = ctx->FrameCount;
+            if (variant == 1)
+                ctx->BeginInputBurst();
+            ctx->KeyChars("Hello");
+            ctx->KeyPress(ImGuiKey_Backspace, 2);
+            ctx->KeyChars("p!");
+            ctx->KeyPress(ImGuiKey_Home);
+            ctx->KeyChars(">");
+            if (variant == 1)
+                ctx->EndInputBurst();
+            const int frame_count_text = ctx->FrameCount - frame_count_start;
+            IM_CHECK_STR_EQ(vars.Str1, ">Help!");
+
+            ctx->MouseMove("Button");
+            if (variant == 1)
+                ctx->BeginInputBurst();
+            ctx->MouseClick();
+            ctx->KeyDown(ImGuiMod_Ctrl);
+            ctx->KeyUp(ImGuiMod_Ctrl);
+            if (variant == 1)
+                ctx->EndInputBurst();
+            IM_CHECK_EQ(vars.Count, 1);
+
+            ctx->LogDebug("%d frames for text input", frame_count_text);
+            if (variant == 0)
+                frame_count_text_regular = frame_count_text;
+            else if (ctx->EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Fast)
+                IM_CHECK_LT(frame_count_text, frame_count_text_regular);
+        }
+    };
+
+    // ## Test virtual clock: fixed delta time, KeyHold() advancing time in few frames
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_virtual_clock");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiContext& g = *ctx->UiContext;
+        const bool backup_virtual_clock = ctx->EngineIO->ConfigVirtualClock;
+        const float backup_fixed_delta_time = ctx->EngineIO->ConfigFixedDeltaTime;
+        const ImGuiTestRunSpeed backup_run_speed = ctx->EngineIO->ConfigRunSpeed;
+        ctx->EngineIO->ConfigVirtualClock = true;
+        ctx->EngineIO->ConfigFixedDeltaTime = 0.0f;
+        ctx->EngineIO->ConfigRunSpeed = ImGuiTestRunSpeed_Fast; // Cinematic mode would add frames before holding
+
+        ctx->Yield(2);
+        const float delta_time = g.IO.DeltaTime;
+        const double time_start = g.Time;
+        const double running_time_start = ctx->RunningTime;
+        const int frame_count_start = ctx->FrameCount;
+        ctx->KeyHold(ImGuiKey_LeftShift, 2.0f);
+        const double time_elapsed = g.Time - time_start;
+        const double running_time_elapsed = ctx->RunningTime - running_time_start;
+        const int frame_count_elapsed = ctx->FrameCount - frame_count_start;
+
+        // Restore before checking so a failure doesn't leak into following tests
+        ctx->EngineIO->ConfigVirtualClock = backup_virtual_clock;
+        ctx->EngineIO->ConfigFixedDeltaTime = backup_fixed_delta_time;
+        ctx->EngineIO->ConfigRunSpeed = backup_run_speed;
+
+        // One frame per key repeat (+1 for rounding of accumulated time), then one frame to release key.
+        const int frame_count_expected = (int)ceilf(2.0f / g.IO.KeyRepeatRate) + 1;
+        IM_CHECK_EQ(delta_time, 1.0f / 60.0f);
+        IM_CHECK_GE(time_elapsed, 2.0);
+        IM_CHECK_GE(running_time_elapsed, 2.0);
+        IM_CHECK_GE(frame_count_elapsed, frame_count_expected);
+        IM_CHECK_LE(frame_count_elapsed, frame_count_expected + 1);
+    };
+
+    // ## Test SleepNoSkip() policies: both observe hover timer crossing a threshold, jumping does it in less frames
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_sleep_policy");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiContext& g = *ctx->UiContext;
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Button("Button");
+        if (ImGui::IsItemHovered() && g.HoveredIdTimer >= 1.0f)
+            ctx->GenericVars.Bool1 = true;
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ctx->SetRef("Test Window");
+        int frames_per_policy[2] = {};
+        for (int policy = ImGuiTestSleepPolicy_Step; policy <= ImGuiTestSleepPolicy_Jump; policy++)
+        {
+            ctx->MouseMoveToVoid();
+            ctx->MouseMove("Button");
+            ctx->GenericVars.Bool1 = false;
+            const int frame_count_start = ctx->FrameCount;
+            ctx->SleepNoSkip(1.5f, 1.0f / 60.0f, (ImGuiTestSleepPolicy)policy);
+            frames_per_policy[policy] = ctx->FrameCount - frame_count_start;
+            IM_CHECK(ctx->GenericVars.Bool1 == true);
+        }
+        IM_CHECK_LT(frames_per_policy[ImGuiTestSleepPolicy_Jump], frames_per_policy[ImGuiTestSleepPolicy_Step]);
+        IM_CHECK_LE(frames_per_policy[ImGuiTestSleepPolicy_Jump], 3);
+    };
+
+    // ## Test log records: lazy formatting, copied string arguments, trimming
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_log_records");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (ctx->EngineIO->ConfigVerboseLevelOnError < ImGuiTestVerboseLevel_Info)
+            return;
+        ImGuiTestLog* log = &ctx->Test->TestLog;
+        char str[16] = "hello";
+        const char str_not_terminated[4] = { 'a', 'b', 'c', 'd' };
+        ctx->LogInfo("First line");
+        ctx->LogInfo("%s %d|%.*s|%5.2f|%llu|%%", str, 42, 2, str_not_terminated, 1.5f, 12345678901ULL);
+        strcpy(str, "bye");
+
+        ImGuiTextBuffer buf;
+        const int line_no = log->LineInfo.Size - 1;
+        log->FormatLine(line_no, &buf);
+        IM_CHECK_STR_EQ(buf.c_str(), Str64f("[%04d] hello 42|ab| 1.50|12345678901|%%\n", ctx->FrameCount).c_str());
+
+        ImGuiTestLog log_copy = *log;
+        log_copy.TrimToLastLines(1);
+        IM_CHECK_EQ(log_copy.LineInfo.Size, 1);
+        IM_CHECK_EQ(log_copy.LinesTrimmed, log->LineInfo.Size - 1);
+        IM_CHECK_EQ(log_copy.ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, ImGuiTestVerboseLevel_Trace, NULL), 1);
+        ImGuiTextBuffer buf_trimmed;
+        log_copy.FormatLine(0, &buf_trimmed);
+        IM_CHECK_STR_EQ(buf_trimmed.c_str(), buf.c_str());
+    };
+
+    // ## Test merging streamed results, including truncated records from a crashed run
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_export_stream_merge");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImFileCreateDirectoryChain("output/");
+        const char* xml_files[] = { "output/export_stream_0.xml", "output/export_stream_1.xml" };
+        const char* xml_contents[] =
+        {
+            "    <testcase name=\"a\" assertions=\"0\" classname=\"misc\" status=\"success\" time=\"1.000\">\n"
+            "      <properties><property name=\"group\" value=\"tests\" /></properties>\n"
+            "    </testcase>\n"
+            "    <testcase name=\"b\" assertions=\"0\" classname=\"perf\" status=\"error\" time=\"0.500\">\n"
+            "      <properties><property name=\"group\" value=\"perfs\" /></properties>\n"
+            "      <failure message=\"\" type=\"error\">\n"
+            "      </failure>\n"
+            "    </testcase>\n",
+            "    <testcase name=\"c\" assertions=\"0\" classname=\"misc\" status=\"success\" time=\"0.250\">\n"
+            "      <properties><property name=\"group\" value=\"tests\" /></properties>\n"
+            "      <system-out>\n",    // Truncated
+        };
+        const char* jsonl_files[] = { "output/export_stream_0.jsonl", "output/export_stream_1.jsonl" };
+        const char* jsonl_contents[] =
+        {
+            "{\"name\":\"a\",\"status\":\"success\"}\n{\"name\":\"b\",\"status\":\"error\"}\n",
+            "{\"name\":\"c\",\"status\":\"success\"}\n{\"name\":\"d\",\"sta",   // Truncated
+        };
+        for (int n = 0; n < 2; n++)
+        {
+            for (int format_n = 0; format_n < 2; format_n++)
+            {
+                FILE* fp = fopen(format_n ? jsonl_files[n] : xml_files[n], "wb");
+                IM_CHECK(fp != NULL);
+                fputs(format_n ? jsonl_contents[n] : xml_contents[n], fp);
+                fclose(fp);
+            }
+        }
+
+        IM_CHECK(ImGuiTestEngine_ExportStreamMerge(xml_files, 2, ImGuiTestEngineExportFormat_JUnitXml, "output/export_stream_merged.xml"));
+        size_t size = 0;
+        char* data = (char*)ImFileLoadToMemory("output/export_stream_merged.xml", "rb", &size, 1);
+        IM_CHECK(data != NULL);
+        IM_CHECK(strstr(data, "<testsuites disabled=\"0\" errors=\"0\" failures=\"1\" name=\"Dear ImGui\" tests=\"2\" time=\"1.500\">") != NULL);
+        IM_CHECK(strstr(data, "<testsuite name=\"perfs\" tests=\"1\" disabled=\"0\" errors=\"0\" failures=\"1\"") != NULL);
+        IM_CHECK(strstr(data, "name=\"c\"") == NULL);
+        IM_CHECK(strstr(data, "</testsuites>\n") != NULL);
+        IM_FREE(data);
+
+        IM_CHECK(ImGuiTestEngine_ExportStreamMerge(jsonl_files, 2, ImGuiTestEngineExportFormat_JsonLines, "output/export_stream_merged.jsonl"));
+        data = (char*)ImFileLoadToMemory("output/export_stream_merged.jsonl", "rb", &size, 1);
+        IM_CHECK(data != NULL);
+        IM_CHECK_STR_EQ(data, "{\"name\":\"a\",\"status\":\"success\"}\n{\"name\":\"b\",\"status\":\"error\"}\n{\"name\":\"c\",\"status\":\"success\"}\n");
+        IM_FREE(data);
+    };
+
+    // ## Test per-test statistics and JSON export
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_export_json");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTest* test = ctx->Test;
+        const int yield_count = test->YieldCount;
+        const int frame_count = test->FrameCount;
+        const double simulated_time = test->SimulatedTime;
+        ctx->Yield(3);
+        IM_CHECK_EQ(test->YieldCount, yield_count + 3);
+        IM_CHECK_EQ(test->FrameCount, frame_count + 3);
+        IM_CHECK_GT(test->SimulatedTime, simulated_time);
+        IM_CHECK_EQ(test->PerfCaptures.Size, 0);
+
+        ImFileCreateDirectoryChain("output/");
+        ImGuiTestEngine_ExportEx(ctx->Engine, ImGuiTestEngineExportFormat_Json, "output/export.json");
+        size_t size = 0;
+        char* data = (char*)ImFileLoadToMemory("output/export.json", "rb", &size, 1);
+        IM_CHECK(data != NULL);
+        const char* header = "{\n\"schema\":\"imgui_test_engine.results\",\n\"version\":1,\n\"batch\":{";
+        IM_CHECK(strncmp(data, header, strlen(header)) == 0);
+        IM_CHECK(strstr(data, "\"name\":\"testengine_export_json\",\"status\":\"running\"") != NULL);
+        IM_CHECK(strstr(data, "\"log_counts\":{\"error\":0,") != NULL);
+        IM_CHECK(strcmp(data + size - 4, "]\n}\n") == 0);
+        IM_FREE(data);
+
+        // Non-finite perf values are written as null
+        ImGuiTestPerfCaptureResult perf;
+        ImStrncpy(perf.Category, "perf", IM_ARRAYSIZE(perf.Category));
+        ImStrncpy(perf.TestName, "perf_non_finite", IM_ARRAYSIZE(perf.TestName));
+        perf.DtRefMs = INFINITY;
+        perf.DtDeltaMs = NAN;
+        test->PerfCaptures.push_back(perf);
+        ImGuiTestEngine_ExportEx(ctx->Engine, ImGuiTestEngineExportFormat_Json, "output/export.json");
+        test->PerfCaptures.pop_back();
+        data = (char*)ImFileLoadToMemory("output/export.json", "rb", &size, 1);
+        IM_CHECK(data != NULL);
+        IM_CHECK(strstr(data, "\"name\":\"perf_non_finite\",\"dt_ref_ms\":null,\"dt_delta_ms\":null,") != NULL);
+        IM_FREE(data);
+    };
 }
 
 //-------------------------------------------------------------------------
 // Tests: Capture
 //-------------------------------------------------------------------------
 
+#if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
+// Headless Null backend doesn't render: its capture function returns false and tests comparing pixels can't run.
+static bool CaptureBackendCanReadPixels(ImGuiTestContext* ctx)
+{
+    ImGuiTestEngineIO* io = ctx->EngineIO;
+    if (!io->ConfigCaptureEnabled || io->ScreenCaptureFunc == NULL)
+        return false;
+    unsigned int pixel = 0;
+    return io->ScreenCaptureFunc(ImGui::GetMainViewport()->ID, 0, 0, 1, 1, &pixel, io->ScreenCaptureUserData);
+}
+#endif
+
 void RegisterTests_Capture(ImGuiTestEngine* e)
 {
 #if IMGUI_TEST_ENGINE_ENABLE_CAPTURE
     ImGuiTest* t = NULL;
 
+    // ## Write screenshots from background threads, results are reported to the log of the test
+    t = IM_REGISTER_TEST(e, "capture", "capture_image_writer");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!CaptureBackendCanReadPixels(ctx))
+        {
+            ctx->LogInfo("Skipping: backend cannot capture pixels.");
+            return;
+        }
+        ImGuiCaptureContext* capture_ctx = &ctx->Engine->CaptureContext;
+        const int backup_writer_threads = ctx->EngineIO->ConfigCaptureWriterThreads;
+        ctx->EngineIO->ConfigCaptureWriterThreads = 2;
+        ctx->Yield(); // Sync engine IO into capture context
+
+        const int files_count = 4;
+        for (int n = 0; n < files_count; n++)
+        {
+            ctx->CaptureReset();
+            ImFormatString(ctx->CaptureArgs->InOutputFile, IM_ARRAYSIZE(ctx->CaptureArgs->InOutputFile), "output/captures/capture_image_writer_%d.png", n);
+            ImFileDelete(ctx->CaptureArgs->InOutputFile);
+            ctx->CaptureScreenshot(ImGuiCaptureFlags_Instant);
+        }
+        capture_ctx->FlushImageWriter();
+        ctx->Yield(); // Completion is reported in ImGuiTestEngine_PostSwap()
+
+        ctx->EngineIO->ConfigCaptureWriterThreads = backup_writer_threads;
+        ctx->Yield();
+
+        for (int n = 0; n < files_count; n++)
+            IM_CHECK(ImFileExist(Str64f("output/captures/capture_image_writer_%d.png", n).c_str()));
+        ImGuiTextBuffer log_text;
+        ctx->Test->TestLog.ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, ImGuiTestVerboseLevel_Trace, &log_text);
+        if (ctx->EngineIO->ConfigVerboseLevelOnError >= ImGuiTestVerboseLevel_Debug)
+            IM_CHECK(strstr(log_text.c_str(), "Wrote 'output/captures/capture_image_writer_3.png'") != NULL);
+    };
+
+    // ## Write golden image then compare new capture with it
+    t = IM_REGISTER_TEST(e, "capture", "capture_compare");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGui::SetNextWindowSize(ImVec2(200, 120), ImGuiCond_Always);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::TextUnformatted("Golden image");
+        ImGui::Button("Button");
+        ImGui::ColorButton("Color", ImVec4(1.0f, 0.5f, 0.0f, 1.0f));
+        ImGui::End();
+        IM_UNUSED(ctx);
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!CaptureBackendCanReadPixels(ctx))
+        {
+            ctx->LogInfo("Skipping: backend cannot capture pixels.");
+            return;
+        }
+        ImGuiTestEngineIO* io = ctx->EngineIO;
+        Str256 backup_goldens_dir(io->CaptureGoldensDir);
+        const bool backup_update_goldens = io->ConfigCaptureUpdateGoldens;
+        ImStrncpy(io->CaptureGoldensDir, "output/goldens", IM_ARRAYSIZE(io->CaptureGoldensDir));
+        ImFileDelete("output/goldens/capture_compare.png");
+
+        // Write golden image
+        io->ConfigCaptureUpdateGoldens = true;
+        ctx->CaptureReset();
+        ctx->CaptureAddWindow("Test Window");
+        ctx->CaptureCompare("capture_compare");
+        const ImVec2 golden_size = ctx->CaptureArgs->OutImageSize;
+
+        // Compare
+        io->ConfigCaptureUpdateGoldens = false;
+        ctx->CaptureReset();
+        ctx->CaptureAddWindow("Test Window");
+        ctx->CaptureArgs->InCompare.InTolerance = 2;
+        ctx->CaptureCompare("capture_compare", ImGuiCaptureFlags_NoSave);
+        const int compares_queued = ctx->CaptureComparesQueued;
+        ctx->Engine->CaptureContext.FlushImageWriter();
+        ctx->Yield(); // Results are reported in ImGuiTestEngine_PostSwap()
+
+        // Restore before checks, which may return early
+        ImStrncpy(io->CaptureGoldensDir, backup_goldens_dir.c_str(), IM_ARRAYSIZE(io->CaptureGoldensDir));
+        io->ConfigCaptureUpdateGoldens = backup_update_goldens;
+
+        IM_CHECK_EQ(compares_queued, 1);
+        IM_CHECK(!ctx->IsError());
+        ImGuiCaptureImageBuf golden;
+        IM_CHECK(golden.LoadFile("output/goldens/capture_compare.png"));
+        IM_CHECK_EQ(golden.Width, (int)golden_size.x);
+        IM_CHECK_EQ(golden.Height, (int)golden_size.y);
+    };
+
+    // ## Compare images with differing pixels: tolerance, failure and ignore rectangles (doesn't need backend pixels)
+    t = IM_REGISTER_TEST(e, "capture", "capture_compare_images");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!ctx->EngineIO->ConfigCaptureEnabled)
+            return;
+        ImGuiCaptureImageBuf golden_image;
+        golden_image.CreateEmpty(64, 48);
+        for (int n = 0; n < golden_image.Width * golden_image.Height; n++)
+            golden_image.Data[n] = IM_COL32(n & 0xFF, 100, 200, 255);
+        ImFileCreateDirectoryChain("output/goldens/");
+        IM_CHECK(golden_image.SaveFile("output/goldens/capture_compare_images.png"));
+
+        ImGuiCaptureContext capture_ctx;
+        ImGuiCaptureArgs args;
+        ImStrncpy(args.InCompare.InGoldenFile, "output/goldens/capture_compare_images.png", IM_ARRAYSIZE(args.InCompare.InGoldenFile));
+        args.InCompare.InAntiAliasingAware = false;
+        const ImRect diff_rect(ImVec2(10, 20), ImVec2(14, 23));  // 4x3 pixels
+        ImGuiCaptureImageBuf image;
+        ImGuiCaptureCompareResult result;
+
+        // Small difference within tolerance
+        image.CreateEmpty(golden_image.Width, golden_image.Height);
+        memcpy(image.Data, golden_image.Data, (size_t)image.Width * image.Height * 4);
+        image.Data[5] ^= IM_COL32(1, 0, 0, 0);
+        args.InCompare.InTolerance = 2;
+        capture_ctx._QueueImageCompare(&image, &args);
+        IM_CHECK(capture_ctx.PollCompareResult(&result));
+        IM_CHECK(result.Success);
+        IM_CHECK_EQ(result.PixelsDifferent, 0);
+
+        // Differing pixels exceeding tolerance
+        for (int pass = 0; pass < 2; pass++)
+        {
+            image.CreateEmpty(golden_image.Width, golden_image.Height);
+            memcpy(image.Data, golden_image.Data, (size_t)image.Width * image.Height * 4);
+            for (int y = (int)diff_rect.Min.y; y < (int)diff_rect.Max.y; y++)
+                for (int x = (int)diff_rect.Min.x; x < (int)diff_rect.Max.x; x++)
+                    image.Data[y * image.Width + x] = IM_COL32(255, 0, 0, 255);
+            args.InCompare.InIgnoreRects.resize(0);
+            if (pass == 1)
+                args.InCompare.InIgnoreRects.push_back(diff_rect);
+            capture_ctx._QueueImageCompare(&image, &args);
+            IM_CHECK(capture_ctx.PollCompareResult(&result));
+            if (pass == 0)
+            {
+                IM_CHECK(!result.Success);
+                IM_CHECK_EQ(result.PixelsDifferent, 4 * 3);
+                IM_CHECK(result.DiffRect.Min.x == diff_rect.Min.x && result.DiffRect.Min.y == diff_rect.Min.y);
+                IM_CHECK(result.DiffRect.Max.x == diff_rect.Max.x && result.DiffRect.Max.y == diff_rect.Max.y);
+            }
+            else
+            {
+                IM_CHECK(result.Success);
+                IM_CHECK_EQ(result.PixelsDifferent, 0);
+                IM_CHECK_EQ(result.PixelsIgnored, 4 * 3);
+            }
+        }
+    };
+
+    // ## Video writer: duplicate frames detection and damage rectangles (writes raw frames to a file, doesn't need video encoder)
+    t = IM_REGISTER_TEST(e, "capture", "capture_video_damage");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!ctx->EngineIO->ConfigCaptureEnabled)
+            return;
+        const int w = 16, h = 8;
+        const char* filename = "output/capture_video_damage.raw";
+        ImFileCreateDirectoryChain("output/");
+        FILE* f = fopen(filename, "wb");
+        IM_CHECK_NO_RET(f != NULL);
+        if (f == NULL)
+            return;
+
+        ImGuiCaptureContext capture_ctx;
+        capture_ctx.VideoDuplicateFrames = ImGuiCaptureVideoDuplicateFrames_Repeat;
+        ImGuiCaptureArgs args;
+        ImStrncpy(args.InOutputFile, filename, IM_ARRAYSIZE(args.InOutputFile));
+        capture_ctx._CreateVideoWriter(f, false, w, h, &args);
+
+        // Pixels are swapped with writer frame buffers: refill image before queuing each frame.
+        ImGuiCaptureImageBuf image;
+        image.CreateEmpty(w, h);
+        auto fill_frame = [&](bool changed)
+        {
+            for (int n = 0; n < w * h; n++)
+                image.Data[n] = IM_COL32(n & 0xFF, 50, 100, 255);
+            if (changed)
+            {
+                image.Data[3 * w + 5] = IM_COL32_WHITE;
+                image.Data[6 * w + 9] = IM_COL32_WHITE;
+            }
+        };
+
+        // First frame: whole image is damaged
+        fill_frame(false);
+        capture_ctx._QueueVideoFrame(&image, &args);
+        IM_CHECK_EQ(args.OutVideoDamageRects.Size, 1);
+        IM_CHECK(args.OutVideoDamageRects[0].Min.x == 0 && args.OutVideoDamageRects[0].Min.y == 0);
+        IM_CHECK(args.OutVideoDamageRects[0].Max.x == w && args.OutVideoDamageRects[0].Max.y == h);
+
+        // Identical frame: repeated, empty damage
+        fill_frame(false);
+        capture_ctx._QueueVideoFrame(&image, &args);
+        IM_CHECK_EQ(args.OutVideoFramesDuplicated, 1);
+        IM_CHECK_EQ(args.OutVideoFramesQueued, 2);
+        IM_CHECK_EQ(args.OutVideoDamageRects.Size, 2);
+        IM_CHECK(args.OutVideoDamageRects[1].GetArea() == 0.0f);
+
+        // Two changed pixels: damage is their bounding rectangle
+        fill_frame(true);
+        capture_ctx._QueueVideoFrame(&image, &args);
+        IM_CHECK_EQ(args.OutVideoDamageRects.Size, 3);
+        IM_CHECK(args.OutVideoDamageRects[2].Min.x == 5 && args.OutVideoDamageRects[2].Min.y == 3);
+        IM_CHECK(args.OutVideoDamageRects[2].Max.x == 10 && args.OutVideoDamageRects[2].Max.y == 7);
+
+        // Skipped duplicate: counted, but not queued and no damage rectangle
+        capture_ctx.VideoDuplicateFrames = ImGuiCaptureVideoDuplicateFrames_Skip;
+        fill_frame(true);
+        capture_ctx._QueueVideoFrame(&image, &args);
+        IM_CHECK_EQ(args.OutVideoFramesDuplicated, 2);
+        IM_CHECK_EQ(args.OutVideoFramesQueued, 3);
+        IM_CHECK_EQ(args.OutVideoDamageRects.Size, 3);
+
+        // Every queued frame (including repeated one) was written
+        capture_ctx._FinalizeVideoWriter();
+        capture_ctx.FlushImageWriter();
+        ImGuiCaptureImageWriterResult result;
+        IM_CHECK(capture_ctx.PollImageWriterResult(&result));
+        IM_CHECK(result.Success);
+        size_t file_size = 0;
+        void* file_data = ImFileLoadToMemory(filename, "rb", &file_size);
+        IM_CHECK_NO_RET(file_data != NULL);
+        IM_CHECK_EQ((int)file_size, args.OutVideoFramesQueued * w * h * 4);
+        IM_FREE(file_data);
+    };
+
+    // ## Video writer: full frame queue (slow video encoder) under each backpressure policy
+    t = IM_REGISTER_TEST(e, "capture", "capture_video_backpressure");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!ctx->EngineIO->ConfigCaptureEnabled)
+            return;
+        const int w = 8, h = 4;
+        const int queue_size = 2;
+        const int frames_count = 5;
+        const char* filename = "output/capture_video_backpressure.raw";
+        ImFileCreateDirectoryChain("output/");
+        for (ImGuiCaptureVideoBackpressure backpressure : { ImGuiCaptureVideoBackpressure_Drop, ImGuiCaptureVideoBackpressure_Grow })
+        {
+            ctx->LogDebug("Backpressure: %s", backpressure == ImGuiCaptureVideoBackpressure_Drop ? "Drop" : "Grow");
+            FILE* f = fopen(filename, "wb");
+            IM_CHECK_NO_RET(f != NULL);
+            if (f == NULL)
+                return;
+
+            ImGuiCaptureContext capture_ctx;
+            capture_ctx.VideoFramesQueueSize = queue_size;
+            capture_ctx.VideoBackpressure = backpressure;
+            capture_ctx.VideoDuplicateFrames = ImGuiCaptureVideoDuplicateFrames_Encode;
+            ImGuiCaptureArgs args;
+            ImStrncpy(args.InOutputFile, filename, IM_ARRAYSIZE(args.InOutputFile));
+            capture_ctx._CreateVideoWriter(f, false, w, h, &args);
+
+            // Writer is paused before any frame is queued: queue gets full after 'queue_size' frames.
+            capture_ctx._PauseVideoWriter(true);
+            ImGuiCaptureImageBuf image;
+            image.CreateEmpty(w, h);
+            for (int frame_n = 0; frame_n < frames_count; frame_n++)
+            {
+                for (int n = 0; n < w * h; n++)
+                    image.Data[n] = IM_COL32(frame_n, n, 0, 255);
+                capture_ctx._QueueVideoFrame(&image, &args);
+            }
+            if (backpressure == ImGuiCaptureVideoBackpressure_Drop)
+            {
+                IM_CHECK_EQ(args.OutVideoFramesQueued, queue_size);
+                IM_CHECK_EQ(args.OutVideoFramesDropped, frames_count - queue_size);
+            }
+            else
+            {
+                IM_CHECK_EQ(args.OutVideoFramesQueued, frames_count);
+                IM_CHECK_EQ(args.OutVideoFramesDropped, 0);
+            }
+            IM_CHECK_EQ(args.OutVideoDamageRects.Size, args.OutVideoFramesQueued);
+
+            // Every queued frame is written once writer resumes
+            capture_ctx._PauseVideoWriter(false);
+            capture_ctx._FinalizeVideoWriter();
+            capture_ctx.FlushImageWriter();
+            ImGuiCaptureImageWriterResult result;
+            IM_CHECK(capture_ctx.PollImageWriterResult(&result));
+            IM_CHECK(result.Success);
+            size_t file_size = 0;
+            void* file_data = ImFileLoadToMemory(filename, "rb", &file_size);
+            IM_CHECK_NO_RET(file_data != NULL);
+            IM_CHECK_EQ((int)file_size, args.OutVideoFramesQueued * w * h * 4);
+            IM_FREE(file_data);
+        }
+    };
+
+    // ## Software renderer: probe pixels for fill rule, alpha blending and clipping (run with -softwarerenderer)
+    t = IM_REGISTER_TEST(e, "capture", "capture_software_renderer");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImDrawList* draw_list = ImGui::GetForegroundDrawList();
+        draw_list->AddRectFilled(ImVec2(8, 8), ImVec2(40, 24), IM_COL32(0, 0, 0, 255));
+        draw_list->AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32(255, 0, 0, 128));     // Two triangles sharing a diagonal
+        draw_list->PushClipRect(ImVec2(24, 12), ImVec2(30, 18));
+        draw_list->AddRectFilled(ImVec2(22, 10), ImVec2(34, 20), IM_COL32(0, 255, 0, 255));
+        draw_list->PopClipRect();
+        IM_UNUSED(ctx);
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        if (io.BackendRendererName == NULL || strcmp(io.BackendRendererName, "imgui_app_software") != 0 || !CaptureBackendCanReadPixels(ctx))
+        {
+            ctx->LogInfo("Skipping: needs software renderer (-softwarerenderer).");
+            return;
+        }
+        ctx->Yield(2);
+
+        const int x0 = 8, y0 = 8;
+        ImGuiCaptureImageBuf image;
+        image.CreateEmpty(32, 16);
+        IM_CHECK(ctx->EngineIO->ScreenCaptureFunc(ImGui::GetMainViewport()->ID, x0, y0, image.Width, image.Height, image.Data, ctx->EngineIO->ScreenCaptureUserData));
+        auto get_pixel = [&](int x, int y) { return image.Data[(y - y0) * image.Width + (x - x0)]; };
+        const ImU32 col_background = IM_COL32(0, 0, 0, 255);
+
+        // Top-left fill rule: pixels of shared diagonal are blended once, edges on pixel boundaries cover whole pixels and nothing outside
+        int pixels_wrong = 0;
+        for (int y = 10; y < 20; y++)
+            for (int x = 10; x < 20; x++)
+                pixels_wrong += (get_pixel(x, y) != IM_COL32(128, 0, 0, 255));     // 50% red over opaque black
+        for (int n = 10; n < 20; n++)
+            pixels_wrong += (get_pixel(9, n) != col_background) + (get_pixel(20, n) != col_background) + (get_pixel(n, 9) != col_background) + (get_pixel(n, 20) != col_background);
+        IM_CHECK_EQ(pixels_wrong, 0);
+
+        // Clip rectangle
+        IM_CHECK_EQ(get_pixel(23, 15), col_background);
+        IM_CHECK_EQ(get_pixel(24, 15), IM_COL32(0, 255, 0, 255));
+        IM_CHECK_EQ(get_pixel(29, 15), IM_COL32(0, 255, 0, 255));
+        IM_CHECK_EQ(get_pixel(30, 15), col_background);
+        IM_CHECK_EQ(get_pixel(26, 11), col_background);
+        IM_CHECK_EQ(get_pixel(26, 12), IM_COL32(0, 255, 0, 255));
+        IM_CHECK_EQ(get_pixel(26, 17), IM_COL32(0, 255, 0, 255));
+        IM_CHECK_EQ(get_pixel(26, 18), col_background);
+    };
+
+    // ## Capture window taller than display in a single chunk by enlarging display (fallback to scrolling when backend doesn't allow it)
+    t = IM_REGISTER_TEST(e, "capture", "capture_stitch_enlarge_display");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGui::SetNextWindowSize(ImVec2(300, 200), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        for (int n = 0; n < 200; n++)
+            ImGui::Text("Line %d", n);
+        ImGui::End();
+        IM_UNUSED(ctx);
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!CaptureBackendCanReadPixels(ctx))
+        {
+            ctx->LogInfo("Skipping: backend cannot capture pixels.");
+            return;
+        }
+        ImGuiIO& io = ImGui::GetIO();
+        const ImVec2 display_size = io.DisplaySize;
+        ImGuiWindow* window = ctx->GetWindowByRef("Test Window");
+        const float content_height = window->ContentSize.y;
+        IM_CHECK_GT(content_height, display_size.y);
+
+        // Backends setting io.DisplaySize from OS window size don't follow enlarged display: capture falls back to scrolling.
+        io.DisplaySize.y += 100.0f;
+        ctx->Yield();
+        const bool can_enlarge_display = (io.DisplaySize.y > display_size.y);
+        io.DisplaySize = display_size;
+        ctx->Yield();
+
+        // Count calls to capture function: window should be captured in a single chunk
+        struct CaptureCounter { ImGuiScreenCaptureFunc* Func; void* UserData; int Count; };
+        CaptureCounter counter = { ctx->EngineIO->ScreenCaptureFunc, ctx->EngineIO->ScreenCaptureUserData, 0 };
+        ctx->EngineIO->ScreenCaptureUserData = &counter;
+        ctx->EngineIO->ScreenCaptureFunc = [](ImGuiID viewport_id, int x, int y, int w, int h, unsigned int* pixels, void* user_data)
+        {
+            CaptureCounter* counter = (CaptureCounter*)user_data;
+            counter->Count++;
+            return counter->Func(viewport_id, x, y, w, h, pixels, counter->UserData);
+        };
+        ctx->CaptureReset();
+        ctx->CaptureAddWindow("Test Window");
+        ctx->CaptureScreenshot(ImGuiCaptureFlags_StitchAll | ImGuiCaptureFlags_EnlargeDisplay | ImGuiCaptureFlags_HideMouseCursor);
+        ctx->EngineIO->ScreenCaptureFunc = counter.Func;
+        ctx->EngineIO->ScreenCaptureUserData = counter.UserData;
+
+        IM_CHECK_GT(ctx->CaptureArgs->OutImageSize.y, content_height);
+        if (can_enlarge_display)
+            IM_CHECK_EQ(counter.Count, 1);
+        else
+            IM_CHECK_GT(counter.Count, 1);
+        IM_CHECK(io.DisplaySize.x == display_size.x && io.DisplaySize.y == display_size.y);
+        IM_CHECK(ctx->Engine->CaptureContext._DisplayEnlarged == false);
+    };
+
+    // ## Save images in other formats, load them back and convert them to PNG
+    t = IM_REGISTER_TEST(e, "capture", "capture_image_formats");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!ctx->EngineIO->ConfigCaptureEnabled)
+            return;
+        ImGuiCaptureImageBuf image;
+        image.CreateEmpty(67, 33);
+        for (int y = 0; y < image.Height; y++)
+            for (int x = 0; x < image.Width; x++)
+                image.Data[y * image.Width + x] = (x < 20) ? IM_COL32(30, 30, 30, 255) : IM_COL32(x * 3, y * 7, (x * y) & 0xFF, (x + y) & 0xFF); // Runs + gradients + alpha
+
+        const char* filenames[] = { "output/captures/capture_image_formats.qoi", "output/captures/capture_image_formats.tga" };
+        for (const char* filename : filenames)
+        {
+            ImFileDelete(filename);
+            IM_CHECK(image.SaveFile(filename));
+        }
+        ImGuiCaptureImageBuf loaded;
+        IM_CHECK(loaded.LoadFile("output/captures/capture_image_formats.qoi"));
+        IM_CHECK_EQ(loaded.Width, image.Width);
+        IM_CHECK_EQ(loaded.Height, image.Height);
+        IM_CHECK(memcmp(loaded.Data, image.Data, (size_t)image.Width * image.Height * 4) == 0);
+
+        // QOI output larger than encoder chunk (64 KB), mixing runs with alpha changes (QOI_OP_RUN + QOI_OP_RGBA = 6 bytes).
+        // Leading pixels encoded with QOI_OP_RGBA only (5 bytes each) shift the ops so every alignment to the chunk end is covered.
+        for (int shift_n = 0; shift_n < 6; shift_n++)
+        {
+            ImGuiCaptureImageBuf large_image;
+            large_image.CreateEmpty(200, 200);
+            ImU32 seed = 0x12345678;
+            ImU32 col = IM_COL32(0, 0, 0, 255);
+            for (int n = 0; n < large_image.Width * large_image.Height; n++)
+            {
+                if (n < shift_n || (n - shift_n) % 3 == 2)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    col = (seed & 0x00FFFFFF) | ((ImU32)(n & 0xFF) << IM_COL32_A_SHIFT);
+                }
+                large_image.Data[n] = col;
+            }
+            IM_CHECK(large_image.SaveFile("output/captures/capture_image_formats_large.qoi"));
+            IM_CHECK(loaded.LoadFile("output/captures/capture_image_formats_large.qoi"));
+            IM_CHECK_EQ(loaded.Width, large_image.Width);
+            IM_CHECK_EQ(loaded.Height, large_image.Height);
+            IM_CHECK(memcmp(loaded.Data, large_image.Data, (size_t)large_image.Width * large_image.Height * 4) == 0);
+        }
+
+        // Corrupt QOI headers: sizes over pixel limit, or more pixels than data can encode, must fail without allocating
+        {
+            const unsigned int corrupt_sizes[][2] = { { 0x8000, 0x8000 }, { 0x1000, 0x1000 } };
+            for (auto& corrupt_size : corrupt_sizes)
+            {
+                unsigned char corrupt_data[22] = { 'q', 'o', 'i', 'f', 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+                for (int n = 0; n < 4; n++)
+                {
+                    corrupt_data[4 + n] = (unsigned char)(corrupt_size[0] >> (24 - n * 8));
+                    corrupt_data[8 + n] = (unsigned char)(corrupt_size[1] >> (24 - n * 8));
+                }
+                ImFileHandle f = ImFileOpen("output/captures/capture_image_formats_corrupt.qoi", "wb");
+                IM_CHECK(f != NULL);
+                ImFileWrite(corrupt_data, 1, sizeof(corrupt_data), f);
+                ImFileClose(f);
+                IM_CHECK(!loaded.LoadFile("output/captures/capture_image_formats_corrupt.qoi"));
+                IM_CHECK(loaded.Data == NULL && loaded.Width == 0 && loaded.Height == 0);
+            }
+        }
+
+        // Batch conversion (synchronous)
+        ImGuiCaptureContext capture_ctx;
+        capture_ctx.PngCompressionLevel = 1;
+        ImFileDelete("output/captures/capture_image_formats.png");
+        IM_CHECK_EQ(capture_ctx.ConvertImageFilesToPng(&filenames[0], 1), 1);
+        ImGuiCaptureImageWriterResult result;
+        IM_CHECK(capture_ctx.PollImageWriterResult(&result));
+        IM_CHECK_STR_EQ(result.Filename, "output/captures/capture_image_formats.png");
+        IM_CHECK(result.Success);
+        IM_CHECK(loaded.LoadFile("output/captures/capture_image_formats.png"));
+        IM_CHECK(memcmp(loaded.Data, image.Data, (size_t)image.Width * image.Height * 4) == 0);
+
+        // Unknown format
+        const char* invalid_filename = "output/captures/capture_image_formats.tga";
+        IM_CHECK_EQ(capture_ctx.ConvertImageFilesToPng(&invalid_filename, 1), 0);
+        IM_CHECK(capture_ctx.PollImageWriterResult(&result));
+        IM_CHECK(!result.Success);
+        IM_CHECK(!image.SaveFile("output/captures/capture_image_formats.xyz"));
+        IM_CHECK(!ImFileExist("output/captures/capture_image_formats.xyz"));
+    };
+
+    // ## Compare vectorized pixel operations with scalar reference, over widths which aren't multiple of SIMD widths (4/8/16 pixels)
+    t = IM_REGISTER_TEST(e, "capture", "capture_image_ops");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImU32 seed = 0x2545F491;
+        auto rand_u32 = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed ^ (seed >> 16); };
+        const int widths[] = { 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 67 };
+        for (int w : widths)
+        {
+            const int h = 6;
+            const int stride = w + 3;
+            const size_t count = (size_t)stride * h;
+            ImVector<unsigned int> src, dst, ref;
+            src.resize((int)count);
+            for (unsigned int& p : src)
+                p = rand_u32();
+            src[0] = IM_COL32(255, 128, 1, 0);      // Alpha edge cases
+            src[(int)count - 1] = IM_COL32(255, 254, 0, 255);
+
+            // Fill alpha
+            dst = src;
+            ImGuiCaptureImageOps_FillAlpha(dst.Data, count, 0xFF);
+            for (size_t n = 0; n < count; n++)
+                IM_CHECK_EQ(dst[(int)n], src[(int)n] | IM_COL32_A_MASK);
+
+            // Swizzle R/B, out of place then in place
+            dst.resize((int)count);
+            ImGuiCaptureImageOps_SwizzleRB(dst.Data, src.Data, count);
+            for (size_t n = 0; n < count; n++)
+            {
+                const unsigned int p = src[(int)n];
+                IM_CHECK_EQ(dst[(int)n], (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16));
+            }
+            ImGuiCaptureImageOps_SwizzleRB(dst.Data, dst.Data, count);
+            IM_CHECK(memcmp(dst.Data, src.Data, count * 4) == 0);
+
+            // Premultiply: round(c * a / 255)
+            ImGuiCaptureImageOps_Premultiply(dst.Data, src.Data, count);
+            for (size_t n = 0; n < count; n++)
+            {
+                const unsigned int p = src[(int)n];
+                const unsigned int a = (p >> IM_COL32_A_SHIFT) & 0xFF;
+                unsigned int expected = p & IM_COL32_A_MASK;
+                const int shifts[] = { IM_COL32_R_SHIFT, IM_COL32_G_SHIFT, IM_COL32_B_SHIFT };
+                for (int shift : shifts)
+                    expected |= ((((p >> shift) & 0xFF) * a * 2 + 255) / 510) << shift;
+                IM_CHECK_EQ(dst[(int)n], expected);
+            }
+
+            // Vertical flip in a strided buffer, padding untouched
+            dst = src;
+            ImGuiCaptureImageOps_FlipVertical(dst.Data, w, h, stride);
+            for (int y = 0; y < h; y++)
+                for (int x = 0; x < stride; x++)
+                    IM_CHECK_EQ(dst[y * stride + x], (x < w) ? src[(h - 1 - y) * stride + x] : src[y * stride + x]);
+
+            // Blit between strided buffers
+            dst.resize(0);
+            dst.resize((int)count, 0);
+            ImGuiCaptureImageOps_Blit(dst.Data, stride, src.Data + 1, stride, w - 1, h - 1);
+            for (int y = 0; y < h; y++)
+                for (int x = 0; x < stride; x++)
+                    IM_CHECK_EQ(dst[y * stride + x], (x < w - 1 && y < h - 1) ? src[y * stride + x + 1] : 0u);
+
+            // Box downscale: rounded average of each block
+            for (int factor = 1; factor <= 3; factor++)
+            {
+                const int dst_w = w / factor;
+                const int dst_h = h / factor;
+                const int dst_stride = dst_w + 1;
+                dst.resize(0);
+                dst.resize(dst_stride * dst_h, 0);
+                ImGuiCaptureImageOps_DownscaleBox(dst.Data, dst_stride, src.Data, stride, w, h, factor);
+                const unsigned int area = (unsigned int)(factor * factor);
+                for (int y = 0; y < dst_h; y++)
+                    for (int x = 0; x < dst_w; x++)
+                    {
+                        unsigned int expected = 0;
+                        for (int c = 0; c < 4; c++)
+                        {
+                            unsigned int sum = 0;
+                            for (int sy = 0; sy < factor; sy++)
+                                for (int sx = 0; sx < factor; sx++)
+                                    sum += (src[(y * factor + sy) * stride + x * factor + sx] >> (c * 8)) & 0xFF;
+                            expected |= ((sum + area / 2) / area) << (c * 8);
+                        }
+                        IM_CHECK_EQ(dst[y * dst_stride + x], expected);
+                    }
+            }
+        }
+        IM_UNUSED(ctx);
+    };
+
     t = IM_REGISTER_TEST(e, "capture", "capture_demo_documents");
     t->TestFunc = [](ImGuiTestContext* ctx)
     {
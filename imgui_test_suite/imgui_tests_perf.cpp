@@ -8,6 +8,8 @@
 #include "imgui_internal.h"
 #include "imgui_test_engine/imgui_te_engine.h"      // IM_REGISTER_TEST()
 #include "imgui_test_engine/imgui_te_context.h"
+#include "imgui_test_engine/imgui_capture_tool.h"    // ImGuiCaptureImageOps_XXX
+#include "imgui_test_engine/imgui_te_utils.h"       // TableXXX helpers, ImDoNotOptimize()
 #include "imgui_test_engine/thirdparty/Str/Str.h"
 
 // Warnings
@@ -1160,5 +1162,1238 @@ void RegisterTests_Perf(ImGuiTestEngine* e)
             }
         }
     }
+
+    // ## "perf_clipper_XXXX" tests: measure ImGuiListClipper over 1M/10M fixed-height items.
+    // Frame cost should only depend on the number of visible items: compare variants over item counts and scroll positions.
+    // PerfStressAmount sets the number of side-by-side lists.
+    {
+        enum PerfClipperMode
+        {
+            PerfClipperMode_Rows,           // Rows in a child window
+            PerfClipperMode_TableFrozen,    // Rows in a scrolling table with frozen rows and columns
+            PerfClipperMode_RandomJumps,    // Scroll to a random row every frame
+            PerfClipperMode_IncludeItem,    // Include a random far away item every frame (e.g. keyboard navigation into clipped range)
+            PerfClipperMode_COUNT
+        };
+        struct PerfClipperVars { ImU32 RandState = 2166136261u; };
+        const char* mode_names[] = { "rows", "table_frozen", "random_jumps", "include_item" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(mode_names) == PerfClipperMode_COUNT);
+        static const int items_counts[] = { 1000000, 10000000 };
+        const char* items_names[] = { "1m", "10m" };
+        static const float scroll_ratios[] = { 0.0f, 0.5f, 1.0f };
+        const char* scroll_names[] = { "top", "mid", "end" };
+
+        auto gui_func = [](ImGuiTestContext* ctx)
+        {
+            PerfClipperVars& vars = ctx->GetVars<PerfClipperVars>();
+            const int mode = ctx->Test->ArgVariant & 0x0F;
+            const int items_count = items_counts[(ctx->Test->ArgVariant >> 4) & 0x0F];
+            const float scroll_ratio = scroll_ratios[(ctx->Test->ArgVariant >> 8) & 0x0F];
+            const int lists_count = ImMax(1, ctx->PerfStressAmount);
+
+            // Same pseudo-random target for all lists in a given frame
+            vars.RandState = vars.RandState * 1664525u + 1013904223u;
+            const int random_item = (int)(vars.RandState % (ImU32)items_count);
+
+            ImGui::SetNextWindowPos(ImGui::GetMainViewport()->Pos + ImVec2(20, 20), ImGuiCond_Always);
+            ImGui::SetNextWindowSize(ImVec2(800, 600), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+            const float list_width = ImMax(80.0f, (ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x * (lists_count - 1)) / lists_count);
+            for (int list_n = 0; list_n < lists_count; list_n++)
+            {
+                if (list_n > 0)
+                    ImGui::SameLine();
+                ImGui::PushID(list_n);
+
+                bool open;
+                if (mode == PerfClipperMode_TableFrozen)
+                {
+                    const int columns_count = 8;
+                    open = ImGui::BeginTable("table", columns_count, ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersV | ImGuiTableFlags_RowBg, ImVec2(list_width, 0.0f));
+                    if (open)
+                    {
+                        ImGui::TableSetupScrollFreeze(2, 1);
+                        for (int column_n = 0; column_n < columns_count; column_n++)
+                            ImGui::TableSetupColumn(column_n == 0 ? "Index" : "Value", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+                        ImGui::TableHeadersRow();
+                    }
+                }
+                else
+                {
+                    open = ImGui::BeginChild("list", ImVec2(list_width, 0.0f), true);
+                }
+
+                if (open)
+                {
+                    ImGuiListClipper clipper;
+                    clipper.Begin(items_count);
+                    if (mode == PerfClipperMode_IncludeItem)
+                    {
+#if IMGUI_VERSION_NUM >= 18960
+                        clipper.IncludeItemByIndex(random_item);
+#elif IMGUI_VERSION_NUM >= 18509
+                        clipper.ForceDisplayRangeByIndices(random_item, random_item + 1);
+#endif
+                    }
+                    while (clipper.Step())
+                    {
+                        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                        {
+                            if (mode == PerfClipperMode_TableFrozen)
+                            {
+                                ImGui::TableNextRow();
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%d", n);
+                                while (ImGui::TableNextColumn())
+                                    ImGui::TextUnformatted("Cell");
+                            }
+                            else
+                            {
+                                ImGui::Text("Item %d", n);
+                            }
+                        }
+                    }
+
+                    // Scroll position is only applied when it changes (except for random jumps)
+                    const float scroll_target = ImFloor(ImGui::GetScrollMaxY() * scroll_ratio);
+                    if (mode == PerfClipperMode_RandomJumps)
+                        ImGui::SetScrollY(random_item * ImGui::GetTextLineHeightWithSpacing());
+                    else if (ImGui::GetScrollY() != scroll_target)
+                        ImGui::SetScrollY(scroll_target);
+                }
+
+                if (mode == PerfClipperMode_TableFrozen)
+                {
+                    if (open)
+                        ImGui::EndTable();
+                }
+                else
+                {
+                    ImGui::EndChild();
+                }
+                ImGui::PopID();
+            }
+            ImGui::End();
+        };
+
+        for (int mode = 0; mode < PerfClipperMode_COUNT; mode++)
+            for (int items_n = 0; items_n < IM_ARRAYSIZE(items_counts); items_n++)
+                for (int scroll_n = 0; scroll_n < IM_ARRAYSIZE(scroll_ratios); scroll_n++)
+                {
+                    // Scroll position variants only for static scrolling. Frozen table and included item use 1M only.
+                    const bool scroll_variants = (mode == PerfClipperMode_Rows || mode == PerfClipperMode_TableFrozen);
+                    if (!scroll_variants && scroll_n > 0)
+                        continue;
+                    if ((mode == PerfClipperMode_TableFrozen || mode == PerfClipperMode_IncludeItem) && items_n > 0)
+                        continue;
+                    t = IM_REGISTER_TEST(e, "perf", "");
+                    if (scroll_variants)
+                        t->SetOwnedName(Str64f("perf_clipper_%s_%s_scroll_%s", mode_names[mode], items_names[items_n], scroll_names[scroll_n]).c_str());
+                    else
+                        t->SetOwnedName(Str64f("perf_clipper_%s_%s", mode_names[mode], items_names[items_n]).c_str());
+                    t->ArgVariant = mode | (items_n << 4) | (scroll_n << 8);
+                    t->SetVarsDataType<PerfClipperVars>();
+                    t->GuiFunc = gui_func;
+                    t->TestFunc = PerfCaptureFunc;
+                }
+    }
+
+    // ## "perf_tables_XXX" tests: measure expensive table paths (sorting, resizing, hiding, reordering, many instances, settings).
+    // Mutations are first performed once through regular inputs, then applied on every frame during a separate capture per phase.
+    // The cost of a phase is the difference with the "_static" (or "_submit") capture of the same test.
+    {
+        struct PerfTablesVars
+        {
+            int                 Phase = 0;
+            int                 Frame = 0;
+            ImVector<int>       Items;          // Sorted item indices
+            ImVector<ImGuiID>   TableIds;       // Table IDs recorded by GuiFunc
+            ImGuiTextBuffer     Ini;            // Generated .ini data
+        };
+
+        // Sort specs change every frame over 100k rows (20k * PerfStressAmount)
+        t = IM_REGISTER_TEST(e, "perf", "perf_tables_sort");
+        t->SetVarsDataType<PerfTablesVars>();
+        t->GuiFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            const int items_count = 20000 * ctx->PerfStressAmount;
+            if (vars.Items.Size != items_count)
+            {
+                vars.Items.resize(items_count);
+                for (int n = 0; n < items_count; n++)
+                    vars.Items[n] = n;
+            }
+            vars.Frame++;
+
+            ImGui::SetNextWindowSize(ImVec2(600, 400), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+            if (ImGui::BeginTable("table_sort", 3, ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersV))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_DefaultSort);
+                ImGui::TableSetupColumn("Value");
+                ImGui::TableSetupColumn("Name");
+
+                // Phase 1: flip sort direction every frame, forcing a full sort
+                if (vars.Phase == 1)
+                    ImGui::TableSetColumnSortDirection(1, (vars.Frame & 1) ? ImGuiSortDirection_Ascending : ImGuiSortDirection_Descending, false);
+
+                // Derive column values from item index. Comparator can't capture, hence the static.
+                static const ImGuiTableSortSpecs* s_sort_specs = NULL;
+                if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+                    if (sort_specs->SpecsDirty)
+                    {
+                        s_sort_specs = sort_specs;
+                        ImQsort(vars.Items.Data, (size_t)vars.Items.Size, sizeof(int), [](const void* lhs, const void* rhs) -> int
+                        {
+                            const int a = *(const int*)lhs;
+                            const int b = *(const int*)rhs;
+                            for (int n = 0; n < s_sort_specs->SpecsCount; n++)
+                            {
+                                const ImGuiTableColumnSortSpecs* spec = &s_sort_specs->Specs[n];
+                                ImU32 value_a = (ImU32)a, value_b = (ImU32)b;
+                                if (spec->ColumnIndex == 1) { value_a *= 2654435761u; value_b *= 2654435761u; }
+                                if (spec->ColumnIndex == 2) { value_a = (value_a ^ 0x5BD1E995) * 2246822519u; value_b = (value_b ^ 0x5BD1E995) * 2246822519u; }
+                                if (value_a != value_b)
+                                    return ((value_a < value_b) == (spec->SortDirection == ImGuiSortDirection_Ascending)) ? -1 : +1;
+                            }
+                            return a - b;
+                        });
+                        s_sort_specs = NULL;
+                        sort_specs->SpecsDirty = false;
+                    }
+                ImGui::TableHeadersRow();
+
+                ImGuiListClipper clipper;
+                clipper.Begin(vars.Items.Size);
+                while (clipper.Step())
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        const ImU32 item = (ImU32)vars.Items[row_n];
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%u", item);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%08X", item * 2654435761u);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("Item %08X", (item ^ 0x5BD1E995) * 2246822519u);
+                    }
+                ImGui::EndTable();
+            }
+            ImGui::End();
+        };
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            ctx->SetRef("Test Func");
+            ctx->TableClickHeader("table_sort", "Value");
+            ctx->TableClickHeader("table_sort", "Name", ImGuiMod_Shift);
+            const ImGuiTableSortSpecs* sort_specs = ctx->TableGetSortSpecs("table_sort");
+            IM_CHECK(sort_specs != NULL);
+            IM_CHECK_EQ(sort_specs->SpecsCount, 2);
+            IM_CHECK_EQ(sort_specs->Specs[0].ColumnIndex, 1);
+
+            vars.Phase = 0;
+            ctx->PerfCapture("perf", "perf_tables_sort_static");
+            vars.Phase = 1;
+            ctx->PerfCapture("perf", "perf_tables_sort_resort");
+        };
+
+        // 64 columns mixing stretch and fixed columns, with resizing or hiding every frame, and reordering by dragging headers.
+        t = IM_REGISTER_TEST(e, "perf", "perf_tables_columns_64");
+        t->SetVarsDataType<PerfTablesVars>();
+        t->GuiFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            const int columns_count = 64;
+            const int rows_count = 20 * ctx->PerfStressAmount;
+            vars.Frame++;
+
+            ImGui::SetNextWindowSize(ImVec2(1200, 600), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+
+            if (ImGui::BeginTable("table_columns", columns_count, ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_BordersV))
+            {
+                for (int column_n = 0; column_n < columns_count; column_n++)
+                {
+                    if (column_n & 1)
+                        ImGui::TableSetupColumn(Str16f("C%d", column_n).c_str(), ImGuiTableColumnFlags_WidthFixed, 50.0f);
+                    else
+                        ImGui::TableSetupColumn(Str16f("C%d", column_n).c_str(), ImGuiTableColumnFlags_WidthStretch, 1.0f);
+                }
+
+                // Phase 1: resize a fixed column every frame
+                if (vars.Phase == 1)
+                    ImGui::TableSetColumnWidth(1, (vars.Frame & 1) ? 40.0f : 60.0f);
+
+                // Phase 2: hide/show a stretch column every frame
+                if (vars.Phase == 2)
+                    ImGui::TableSetColumnEnabled(2, (vars.Frame & 1) != 0);
+
+                ImGui::TableHeadersRow();
+                for (int row_n = 0; row_n < rows_count; row_n++)
+                {
+                    ImGui::TableNextRow();
+                    while (ImGui::TableNextColumn())
+                        ImGui::TextUnformatted("Cell");
+                }
+                ImGui::EndTable();
+            }
+            ImGui::End();
+        };
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            ctx->SetRef("Test Func");
+            ctx->TableResizeColumn("table_columns", 1, 80.0f);
+            ctx->TableSetColumnEnabled("table_columns", "C2", false);
+            ctx->TableSetColumnEnabled("table_columns", "C2", true);
+
+            const char* phase_names[] = { "perf_tables_columns_64_static", "perf_tables_columns_64_resize", "perf_tables_columns_64_hide" };
+            for (int phase = 0; phase < IM_ARRAYSIZE(phase_names); phase++)
+            {
+                vars.Phase = phase;
+                ctx->PerfCapture("perf", phase_names[phase]);
+            }
+            vars.Phase = 0;
+
+            // Reorder with mouse inputs: drag first header over its neighbour, then back.
+            // Average frame time of the drags is recorded relative to reference frame time, like captures above.
+            ImGuiTable* table = ImGui::TableFindByID(ctx->GetID("table_columns"));
+            IM_CHECK(table != NULL);
+            const int reorders_count = 10 * ctx->PerfStressAmount;
+            const double time_start = ImGui::GetTime();
+            const int frame_start = ImGui::GetFrameCount();
+            for (int n = 0; n < reorders_count; n++)
+                ctx->ItemDragAndDrop(TableGetHeaderID(table, "C0"), TableGetHeaderID(table, "C1"));
+            const double dt_avg = (ImGui::GetTime() - time_start) / (double)(ImGui::GetFrameCount() - frame_start);
+            IM_CHECK_EQ(table->Columns[0].DisplayOrder, reorders_count & 1);
+            ctx->PerfCaptureValue("perf", "perf_tables_columns_64_reorder", (dt_avg - ctx->PerfRefDt) * 1000.0);
+        };
+
+        // Hundreds of table instances sharing a same ID (500 at default PerfStressAmount). Sort specs and column widths are shared.
+        t = IM_REGISTER_TEST(e, "perf", "perf_tables_instances_shared_id");
+        t->GuiFunc = [](ImGuiTestContext* ctx)
+        {
+            const int instances_count = 100 * ctx->PerfStressAmount;
+            ImGui::SetNextWindowSize(ImVec2(600, 600), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+            for (int instance_n = 0; instance_n < instances_count; instance_n++)
+                if (ImGui::BeginTable("table_instances", 4, ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_BordersV))
+                {
+                    ImGui::TableSetupColumn("C0");
+                    ImGui::TableSetupColumn("C1");
+                    ImGui::TableSetupColumn("C2");
+                    ImGui::TableSetupColumn("C3");
+                    ImGui::TableHeadersRow();
+                    for (int row_n = 0; row_n < 3; row_n++)
+                    {
+                        ImGui::TableNextRow();
+                        while (ImGui::TableNextColumn())
+                            ImGui::TextUnformatted("Cell");
+                    }
+                    ImGui::EndTable();
+                }
+            ImGui::End();
+        };
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            ctx->SetRef("Test Func");
+            ImGuiTable* table = ImGui::TableFindByID(ctx->GetID("table_instances"));
+            IM_CHECK(table != NULL);
+            IM_CHECK_EQ(table->InstanceCurrent, 100 * ctx->PerfStressAmount - 1);
+
+            // Sort from second instance, applies to all instances
+            ctx->ItemClick(TableGetHeaderID(table, "C1", 1));
+            const ImGuiTableSortSpecs* sort_specs = ctx->TableGetSortSpecs("table_instances");
+            IM_CHECK(sort_specs != NULL && sort_specs->SpecsCount == 1);
+            IM_CHECK_EQ(sort_specs->Specs[0].ColumnIndex, 1);
+
+            ctx->PerfCapture();
+        };
+
+        // Settings load for many tables (200 tables with 16 columns at default PerfStressAmount).
+        // Loading .ini data flags all existing tables to reapply their settings on their next BeginTable().
+        t = IM_REGISTER_TEST(e, "perf", "perf_tables_settings_load");
+        t->SetVarsDataType<PerfTablesVars>();
+        t->GuiFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            const int tables_count = 40 * ctx->PerfStressAmount;
+            const int columns_count = 16;
+
+            // Phase 1: load settings every frame
+            if (vars.Phase == 1)
+                ImGui::LoadIniSettingsFromMemory(vars.Ini.c_str(), (size_t)vars.Ini.size());
+
+            // Settings are not loaded for tables in a window with ImGuiWindowFlags_NoSavedSettings
+            vars.TableIds.resize(0);
+            ImGui::SetNextWindowSize(ImVec2(800, 600), ImGuiCond_Always);
+            ImGui::Begin("Test Tables Settings", NULL, ImGuiWindowFlags_None);
+            for (int table_n = 0; table_n < tables_count; table_n++)
+            {
+                ImGui::PushID(table_n);
+                if (ImGui::BeginTable("table", columns_count, ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable))
+                {
+                    vars.TableIds.push_back(ImGui::GetCurrentTable()->ID);
+                    for (int column_n = 0; column_n < columns_count; column_n++)
+                        ImGui::TableSetupColumn(Str16f("C%d", column_n).c_str());
+                    ImGui::TableHeadersRow();
+                    ImGui::TableNextRow();
+                    while (ImGui::TableNextColumn())
+                        ImGui::TextUnformatted("Cell");
+                    ImGui::EndTable();
+                }
+                ImGui::PopID();
+            }
+            ImGui::End();
+        };
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            PerfTablesVars& vars = ctx->GetVars<PerfTablesVars>();
+            const int columns_count = 16;
+            ctx->Yield();
+            IM_CHECK_EQ(vars.TableIds.Size, 40 * ctx->PerfStressAmount);
+
+            // Generate settings for all tables: reversed column order, one hidden column, sorted on first column.
+            vars.Ini.clear();
+            for (ImGuiID table_id : vars.TableIds)
+            {
+                vars.Ini.appendf("[Table][0x%08X,%d]\n", table_id, columns_count);
+                for (int column_n = 0; column_n < columns_count; column_n++)
+                {
+                    vars.Ini.appendf("Column %-2d Weight=1.0000 Visible=%d Order=%d", column_n, (column_n != 3) ? 1 : 0, columns_count - 1 - column_n);
+                    vars.Ini.append(column_n == 0 ? " Sort=0v\n" : "\n");
+                }
+                vars.Ini.append("\n");
+            }
+
+            vars.Phase = 0;
+            ctx->PerfCapture("perf", "perf_tables_settings_load_submit");
+            vars.Phase = 1;
+            ctx->PerfCapture("perf", "perf_tables_settings_load_apply");
+            vars.Phase = 0;
+
+            ImGuiTable* table = ImGui::TableFindByID(vars.TableIds[0]);
+            IM_CHECK(table != NULL);
+            IM_CHECK_EQ(table->Columns[0].DisplayOrder, columns_count - 1);
+            IM_CHECK_EQ(table->Columns[3].IsUserEnabled, false);
+
+            // Don't leave settings behind
+            for (ImGuiID table_id : vars.TableIds)
+                TableDiscardInstanceAndSettings(table_id);
+            ImGui::TableGcCompactSettings();
+        };
+    }
+
+#ifdef IMGUI_HAS_DOCK
+    // ## "perf_docking_XXX" tests: measure docking with a tree of dock nodes built with DockBuilder (150 windows in 50 leaf nodes at default PerfStressAmount).
+    // Each transition is applied on every frame during a separate capture. The transition latency is the difference with the "_static" capture.
+    {
+        enum PerfDockingPhase
+        {
+            PerfDockingPhase_Static,
+            PerfDockingPhase_Rebuild,       // Rebuild whole tree with DockBuilder
+            PerfDockingPhase_Split,         // Split a leaf node and dock a window in it, then merge back
+            PerfDockingPhase_DockUndock,    // Undock a window, then dock it back
+            PerfDockingPhase_TabReorder,    // Reorder first tab of a leaf node
+            PerfDockingPhase_IniLoad,       // Load .ini data including all dock nodes (clears and recreates all nodes)
+        };
+        struct PerfDockingVars
+        {
+            int                 Phase = PerfDockingPhase_Static;
+            int                 Frame = 0;
+            bool                RebuildTree = true;
+            ImGuiID             DockspaceId = 0;
+            ImVector<ImGuiID>   LeafIds;
+            ImGuiTextBuffer     Ini;
+        };
+
+        auto gui_func = [](ImGuiTestContext* ctx)
+        {
+            PerfDockingVars& vars = ctx->GetVars<PerfDockingVars>();
+            const int windows_count = 30 * ctx->PerfStressAmount;
+            const int leaves_count = ImMax(1, windows_count / 3);
+            vars.Frame++;
+
+            if (vars.Phase == PerfDockingPhase_IniLoad)
+                ImGui::LoadIniSettingsFromMemory(vars.Ini.c_str(), (size_t)vars.Ini.size());
+
+            ImGui::SetNextWindowPos(ImGui::GetMainViewport()->Pos + ImVec2(20, 20), ImGuiCond_Always);
+            ImGui::SetNextWindowSize(ImVec2(1200, 800), ImGuiCond_Always);
+            ImGui::Begin("Test Dock Host", NULL, ImGuiWindowFlags_None);
+            vars.DockspaceId = ImGui::GetID("dockspace");
+            if (vars.RebuildTree || vars.Phase == PerfDockingPhase_Rebuild)
+            {
+                // Split leaves breadth-first, alternating directions
+                ImGui::DockBuilderRemoveNode(vars.DockspaceId);
+                ImGui::DockBuilderAddNode(vars.DockspaceId, ImGuiDockNodeFlags_DockSpace);
+                ImGui::DockBuilderSetNodeSize(vars.DockspaceId, ImGui::GetContentRegionAvail());
+                vars.LeafIds.resize(0);
+                vars.LeafIds.push_back(vars.DockspaceId);
+                for (int split_n = 0; vars.LeafIds.Size < leaves_count; split_n++)
+                {
+                    ImGuiID parent_id = vars.LeafIds[0];
+                    ImGuiID child_a = 0, child_b = 0;
+                    vars.LeafIds.erase(vars.LeafIds.Data);
+                    ImGui::DockBuilderSplitNode(parent_id, (split_n & 1) ? ImGuiDir_Up : ImGuiDir_Left, 0.5f, &child_a, &child_b);
+                    vars.LeafIds.push_back(child_a);
+                    vars.LeafIds.push_back(child_b);
+                }
+                for (int window_n = 0; window_n < windows_count; window_n++)
+                    ImGui::DockBuilderDockWindow(Str16f("Dock %03d", window_n).c_str(), vars.LeafIds[window_n % vars.LeafIds.Size]);
+                ImGui::DockBuilderFinish(vars.DockspaceId);
+                vars.RebuildTree = false;
+            }
+            else if (vars.Phase == PerfDockingPhase_Split)
+            {
+                if (vars.Frame & 1)
+                {
+                    ImGuiID child_a = 0, child_b = 0;
+                    ImGui::DockBuilderSplitNode(vars.LeafIds[0], ImGuiDir_Right, 0.5f, &child_a, &child_b);
+                    ImGui::DockBuilderDockWindow("Dock 000", child_b);
+                    ImGui::DockBuilderFinish(vars.DockspaceId);
+                }
+                else
+                {
+                    ImGui::DockBuilderRemoveNodeChildNodes(vars.LeafIds[0]);
+                }
+            }
+            else if (vars.Phase == PerfDockingPhase_DockUndock)
+            {
+                ImGui::DockBuilderDockWindow("Dock 000", (vars.Frame & 1) ? 0 : vars.LeafIds[0]);
+            }
+            else if (vars.Phase == PerfDockingPhase_TabReorder)
+            {
+                if (ImGuiDockNode* node = ImGui::DockBuilderGetNode(vars.LeafIds[0]))
+                    if (node->TabBar && node->TabBar->Tabs.Size > 1)
+                        ImGui::TabBarQueueReorder(node->TabBar, &node->TabBar->Tabs[0], +1);
+            }
+            ImGui::DockSpace(vars.DockspaceId);
+            ImGui::End();
+
+            for (int window_n = 0; window_n < windows_count; window_n++)
+            {
+                ImGui::Begin(Str16f("Dock %03d", window_n).c_str(), NULL, ImGuiWindowFlags_None);
+                ImGui::Text("Window %d", window_n);
+                ImGui::Button("Button");
+                ImGui::End();
+            }
+        };
+
+        auto test_func = [](ImGuiTestContext* ctx)
+        {
+            PerfDockingVars& vars = ctx->GetVars<PerfDockingVars>();
+            const int windows_count = 30 * ctx->PerfStressAmount;
+            ctx->Yield(2);
+            IM_CHECK_EQ(vars.LeafIds.Size, ImMax(1, windows_count / 3));
+            ImGuiWindow* window = ctx->GetWindowByRef("//Dock 000");
+            IM_CHECK(window != NULL && window->DockNode != NULL);
+            IM_CHECK_EQ(window->DockNode->ID, vars.LeafIds[0]);
+
+            struct PerfDockingCapture { int Phase; const char* Name; };
+            const PerfDockingCapture captures_tree[] =
+            {
+                { PerfDockingPhase_Static,      "perf_docking_tree_static" },
+                { PerfDockingPhase_Rebuild,     "perf_docking_tree_rebuild" },
+                { PerfDockingPhase_Split,       "perf_docking_tree_split" },
+                { PerfDockingPhase_DockUndock,  "perf_docking_tree_dock_undock" },
+                { PerfDockingPhase_TabReorder,  "perf_docking_tree_tab_reorder" },
+            };
+            const PerfDockingCapture captures_ini[] =
+            {
+                { PerfDockingPhase_Static,      "perf_docking_ini_load_static" },
+                { PerfDockingPhase_IniLoad,     "perf_docking_ini_load_apply" },
+            };
+            const PerfDockingCapture* captures = (ctx->Test->ArgVariant == 0) ? captures_tree : captures_ini;
+            const int captures_count = (ctx->Test->ArgVariant == 0) ? IM_ARRAYSIZE(captures_tree) : IM_ARRAYSIZE(captures_ini);
+
+            if (ctx->Test->ArgVariant == 0)
+            {
+                // Perform transitions once through regular inputs
+                ctx->UndockWindow("Dock 001");
+                ctx->DockInto("//Dock 001", "//Dock 002");
+                IM_CHECK_EQ(ctx->GetWindowByRef("//Dock 001")->DockNode, ctx->GetWindowByRef("//Dock 002")->DockNode);
+            }
+            else
+            {
+                size_t ini_size = 0;
+                const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_size);
+                vars.Ini.clear();
+                vars.Ini.append(ini_data, ini_data + ini_size);
+                ctx->LogInfo("Ini data: %d bytes, %d dock nodes", (int)ini_size, ctx->UiContext->DockContext.NodesSettings.Size);
+            }
+
+            const int captures_start = ctx->Test->PerfCaptures.Size;
+            for (int capture_n = 0; capture_n < captures_count && !ctx->IsError(); capture_n++)
+            {
+                vars.RebuildTree = true;
+                vars.Phase = captures[capture_n].Phase;
+                ctx->PerfCapture("perf", captures[capture_n].Name);
+                if (capture_n > 0 && ctx->Test->PerfCaptures.Size == captures_start + capture_n + 1)
+                {
+                    const double latency_ms = ctx->Test->PerfCaptures.back().DtDeltaMs - ctx->Test->PerfCaptures[captures_start].DtDeltaMs;
+                    ctx->LogInfo("[PERF] Transition latency: %+6.3f ms (%s)", latency_ms, captures[capture_n].Name);
+                }
+            }
+            vars.Phase = PerfDockingPhase_Static;
+            ctx->Yield();
+            IM_CHECK(ImGui::DockBuilderGetNode(vars.DockspaceId) != NULL);
+
+            // Don't leave dock nodes and settings behind
+            ImGui::DockBuilderRemoveNode(vars.DockspaceId);
+#if IMGUI_VERSION_NUM >= 18928
+            ImGui::ClearWindowSettings("Test Dock Host");
+            for (int window_n = 0; window_n < windows_count; window_n++)
+                ImGui::ClearWindowSettings(Str16f("Dock %03d", window_n).c_str());
+#endif
+        };
+
+        t = IM_REGISTER_TEST(e, "perf", "perf_docking_tree");
+        t->SetVarsDataType<PerfDockingVars>();
+        t->ArgVariant = 0;
+        t->GuiFunc = gui_func;
+        t->TestFunc = test_func;
+
+        t = IM_REGISTER_TEST(e, "perf", "perf_docking_ini_load");
+        t->SetVarsDataType<PerfDockingVars>();
+        t->ArgVariant = 1;
+        t->GuiFunc = gui_func;
+        t->TestFunc = test_func;
+    }
+#endif
+
+    // ## "perf_input_text_edit_XXX" tests: measure editing a single multi-line buffer of 1MB/10MB.
+    // Each edit operation is submitted as an input burst. Its latency is the duration of the longest frame until it has been
+    // processed (time to next frame), averaged over 2 * PerfStressAmount repeats and recorded with PerfCaptureValue().
+    // Frame cost of the idle active field is also captured.
+    {
+        enum PerfInputTextEditOp
+        {
+            PerfInputTextEditOp_Insert,
+            PerfInputTextEditOp_Delete,
+            PerfInputTextEditOp_Paste,
+            PerfInputTextEditOp_Undo,
+            PerfInputTextEditOp_SelectAll,
+            PerfInputTextEditOp_COUNT
+        };
+        struct PerfInputTextEditVars
+        {
+            ImVector<char>  Buf;
+            float           FrameDtMax = 0.0f;  // Longest DeltaTime since last reset
+        };
+        static const int buf_sizes[] = { 1 << 20, 10 << 20 };
+        const char* size_names[] = { "1mb", "10mb" };
+
+        auto gui_func = [](ImGuiTestContext* ctx)
+        {
+            PerfInputTextEditVars& vars = ctx->GetVars<PerfInputTextEditVars>();
+            if (vars.Buf.Size == 0)
+            {
+                // Fill with numbered lines, leaving room for insertions
+                const int buf_size = buf_sizes[ctx->Test->ArgVariant];
+                vars.Buf.resize(buf_size + (64 << 10));
+                int len = 0;
+                for (int line_n = 0; len + 128 < buf_size; line_n++)
+                    len += ImFormatString(vars.Buf.Data + len, (size_t)(vars.Buf.Size - len), "%07d: The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet.\n", line_n);
+                vars.Buf[len] = 0;
+            }
+            vars.FrameDtMax = ImMax(vars.FrameDtMax, ImGui::GetIO().DeltaTime);
+
+            ImGui::SetNextWindowSize(ImVec2(800, 600), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+            ImGui::InputTextMultiline("##Document", vars.Buf.Data, (size_t)vars.Buf.Size, ImVec2(-FLT_MIN, -FLT_MIN));
+            ImGui::End();
+        };
+
+        auto test_func = [](ImGuiTestContext* ctx)
+        {
+            // Names are stored by perf tool, they need to be persistent.
+            static const char* capture_names[][PerfInputTextEditOp_COUNT + 1] =
+            {
+                { "perf_input_text_edit_1mb_idle", "perf_input_text_edit_1mb_insert", "perf_input_text_edit_1mb_delete", "perf_input_text_edit_1mb_paste", "perf_input_text_edit_1mb_undo", "perf_input_text_edit_1mb_select_all" },
+                { "perf_input_text_edit_10mb_idle", "perf_input_text_edit_10mb_insert", "perf_input_text_edit_10mb_delete", "perf_input_text_edit_10mb_paste", "perf_input_text_edit_10mb_undo", "perf_input_text_edit_10mb_select_all" },
+            };
+            IM_STATIC_ASSERT(IM_ARRAYSIZE(capture_names) == IM_ARRAYSIZE(buf_sizes));
+            const char** names = capture_names[ctx->Test->ArgVariant];
+
+            PerfInputTextEditVars& vars = ctx->GetVars<PerfInputTextEditVars>();
+            ctx->SetRef("Test Func");
+            ctx->ItemClick("##Document");
+            IM_CHECK(ImGui::GetInputTextState(ctx->GetID("##Document")) != NULL);
+            const int len_initial = (int)strlen(vars.Buf.Data);
+
+            ctx->PerfCapture("perf", names[0]);
+
+            // Paste text must fit in undo buffer (STB_TEXTEDIT_UNDOCHARCOUNT)
+            ImGuiTextBuffer paste_text;
+            for (int line_n = 0; line_n < 8; line_n++)
+                paste_text.appendf("Pasted line %d: The quick brown fox jumps over the lazy dog.\n", line_n);
+            ImGui::SetClipboardText(paste_text.c_str());
+
+            const char* insert_text = "Hello, world! ";
+            const int repeat_count = 2 * ctx->PerfStressAmount;
+            double latency_total_ms[PerfInputTextEditOp_COUNT] = {};
+            for (int repeat_n = 0; repeat_n < repeat_count && !ctx->IsError(); repeat_n++)
+                for (int op = 0; op < PerfInputTextEditOp_COUNT; op++)
+                {
+                    vars.FrameDtMax = 0.0f;
+                    ctx->BeginInputBurst();
+                    switch (op)
+                    {
+                    case PerfInputTextEditOp_Insert:    ctx->KeyChars(insert_text); break;
+                    case PerfInputTextEditOp_Delete:    ctx->KeyPress(ImGuiKey_Backspace, (int)strlen(insert_text)); break;
+                    case PerfInputTextEditOp_Paste:     ctx->KeyPress(ImGuiMod_Shortcut | ImGuiKey_V); break;
+                    case PerfInputTextEditOp_Undo:      ctx->KeyPress(ImGuiMod_Shortcut | ImGuiKey_Z); break;
+                    case PerfInputTextEditOp_SelectAll: ctx->KeyPress(ImGuiMod_Shortcut | ImGuiKey_A); break;
+                    }
+                    ctx->EndInputBurst();
+                    latency_total_ms[op] += vars.FrameDtMax * 1000.0;
+
+                    // Collapse selection to its start before next insertion
+                    if (op == PerfInputTextEditOp_SelectAll)
+                        ctx->KeyPress(ImGuiKey_LeftArrow);
+                }
+
+            // Every repeat leaves the document unchanged
+            IM_CHECK_EQ((int)strlen(vars.Buf.Data), len_initial);
+
+            for (int op = 0; op < PerfInputTextEditOp_COUNT; op++)
+                ctx->PerfCaptureValue("perf", names[op + 1], latency_total_ms[op] / repeat_count);
+        };
+
+        for (int size_n = 0; size_n < IM_ARRAYSIZE(buf_sizes); size_n++)
+        {
+            t = IM_REGISTER_TEST(e, "perf", "");
+            t->SetOwnedName(Str64f("perf_input_text_edit_%s", size_names[size_n]).c_str());
+            t->ArgVariant = size_n;
+            t->SetVarsDataType<PerfInputTextEditVars>();
+            t->GuiFunc = gui_func;
+            t->TestFunc = test_func;
+        }
+    }
+
+    // ## "perf_nav_XXX" tests: measure keyboard navigation scoring over dense grids of 10k/100k items.
+    // Nav move requests score every submitted item (including clipped ones). Frame cost is captured with a nav id set ("_static")
+    // and with a move request submitted on every frame ("_moving"). Latency of NavMoveTo(), arrow key presses and PageUp/PageDown
+    // is the duration of the longest frame until the move completed, averaged over repeats and recorded with PerfCaptureValue().
+    {
+        enum PerfNavLayout
+        {
+            PerfNavLayout_Grid,             // Buttons in a single window
+            PerfNavLayout_Children,         // Buttons in 10x10 nested child windows
+            PerfNavLayout_Table,            // Buttons in a 50 columns scrolling table
+            PerfNavLayout_COUNT
+        };
+        enum PerfNavCapture
+        {
+            PerfNavCapture_Static,
+            PerfNavCapture_Moving,
+            PerfNavCapture_MoveTo,
+            PerfNavCapture_Arrow,
+            PerfNavCapture_Page,
+            PerfNavCapture_COUNT
+        };
+        struct PerfNavVars
+        {
+            int             Frame = 0;
+            bool            MoveEveryFrame = false;
+            float           FrameDtMax = 0.0f;  // Longest DeltaTime since last reset
+            ImGuiID         TargetIds[16] = {}; // Evenly spaced items
+        };
+        const char* layout_names[] = { "grid", "children", "table" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(layout_names) == PerfNavLayout_COUNT);
+        static const int items_counts[] = { 10000, 100000 };
+        const char* items_names[] = { "10k", "100k" };
+        const char* capture_suffixes[] = { "static", "moving", "move_to", "arrow", "page" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(capture_suffixes) == PerfNavCapture_COUNT);
+
+        // Names are stored by perf tool, they need to be persistent.
+        static char capture_names[PerfNavLayout_COUNT][IM_ARRAYSIZE(items_counts)][PerfNavCapture_COUNT][48];
+
+        auto gui_func = [](ImGuiTestContext* ctx)
+        {
+            PerfNavVars& vars = ctx->GetVars<PerfNavVars>();
+            const int layout = ctx->Test->ArgVariant & 0x0F;
+            const int items_count = items_counts[(ctx->Test->ArgVariant >> 4) & 0x0F];
+            const int target_step = items_count / IM_ARRAYSIZE(vars.TargetIds);
+            vars.FrameDtMax = ImMax(vars.FrameDtMax, ImGui::GetIO().DeltaTime);
+            vars.Frame++;
+
+#if IMGUI_VERSION_NUM >= 18700
+            // Submit a move request every frame, alternating directions
+            ImGuiContext& g = *ctx->UiContext;
+            if (vars.MoveEveryFrame && g.NavWindow != NULL && !g.NavMoveSubmitted)
+            {
+                const ImGuiDir move_dir = (vars.Frame & 1) ? ImGuiDir_Down : ImGuiDir_Up;
+                ImGui::NavMoveRequestSubmit(move_dir, move_dir, ImGuiNavMoveFlags_None, ImGuiScrollFlags_None);
+            }
+#endif
+
+            // Don't use GetItemID(): LastItemData is not updated when an item is skipped by its window.
+            auto submit_item = [&vars, target_step](int n)
+            {
+                ImGui::PushID(n);
+                if (n % target_step == 0)
+                    vars.TargetIds[n / target_step] = ImGui::GetID("##item");
+                ImGui::Button("##item", ImVec2(8.0f, 8.0f));
+                ImGui::PopID();
+            };
+
+            ImGui::SetNextWindowPos(ImGui::GetMainViewport()->Pos + ImVec2(20, 20), ImGuiCond_Always);
+            ImGui::SetNextWindowSize(ImVec2(1000, 700), ImGuiCond_Always);
+            ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+            if (layout == PerfNavLayout_Grid)
+            {
+                for (int n = 0; n < items_count; n++)
+                {
+                    if (n % 100)
+                        ImGui::SameLine();
+                    submit_item(n);
+                }
+            }
+            else if (layout == PerfNavLayout_Children)
+            {
+                // All child windows fit in host window: a clipped child window would skip its items, making them unreachable.
+                const int items_per_child = items_count / 100;
+                for (int outer_n = 0, n = 0; outer_n < 10; outer_n++)
+                {
+                    ImGui::PushID(outer_n);
+                    if (outer_n > 0)
+                        ImGui::SameLine();
+                    ImGui::BeginChild("outer", ImVec2(90.0f, 0.0f), true);
+                    for (int inner_n = 0; inner_n < 10; inner_n++)
+                    {
+                        ImGui::PushID(inner_n);
+                        ImGui::BeginChild("inner", ImVec2(0.0f, 56.0f), true);
+                        for (int item_n = 0; item_n < items_per_child; item_n++, n++)
+                        {
+                            if (item_n % 4)
+                                ImGui::SameLine();
+                            submit_item(n);
+                        }
+                        ImGui::EndChild();
+                        ImGui::PopID();
+                    }
+                    ImGui::EndChild();
+                    ImGui::PopID();
+                }
+            }
+            else if (layout == PerfNavLayout_Table)
+            {
+                const int columns_count = 50;
+                if (ImGui::BeginTable("table", columns_count, ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit))
+                {
+                    for (int n = 0; n < items_count; n++)
+                    {
+                        if (n % columns_count == 0)
+                            ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        submit_item(n);
+                    }
+                    ImGui::EndTable();
+                }
+            }
+            ImGui::End();
+        };
+
+        auto test_func = [](ImGuiTestContext* ctx)
+        {
+            PerfNavVars& vars = ctx->GetVars<PerfNavVars>();
+            char (*names)[48] = capture_names[ctx->Test->ArgVariant & 0x0F][(ctx->Test->ArgVariant >> 4) & 0x0F];
+            ImGuiContext& g = *ctx->UiContext;
+
+            ctx->SetRef("Test Func");
+            ctx->SetInputMode(ImGuiInputSource_Keyboard);
+            ctx->NavMoveTo(vars.TargetIds[IM_ARRAYSIZE(vars.TargetIds) / 2]);
+            IM_CHECK(g.NavId != 0);
+
+            ctx->PerfCapture("perf", names[PerfNavCapture_Static]);
+#if IMGUI_VERSION_NUM >= 18700
+            vars.MoveEveryFrame = true;
+            ctx->PerfCapture("perf", names[PerfNavCapture_Moving]);
+            vars.MoveEveryFrame = false;
+#endif
+
+            const int moves_count = 2 * ctx->PerfStressAmount;
+            const int arrow_presses_per_move = 5;
+            double latency_total_ms[PerfNavCapture_COUNT] = {};
+            for (int move_n = 0; move_n < moves_count && !ctx->IsError(); move_n++)
+            {
+                vars.FrameDtMax = 0.0f;
+                ctx->NavMoveTo(vars.TargetIds[(move_n * 5 + 3) % IM_ARRAYSIZE(vars.TargetIds)]);
+                latency_total_ms[PerfNavCapture_MoveTo] += vars.FrameDtMax * 1000.0;
+
+                for (int press_n = 0; press_n < arrow_presses_per_move; press_n++)
+                {
+                    vars.FrameDtMax = 0.0f;
+                    ctx->KeyPress((press_n & 1) ? ImGuiKey_RightArrow : ImGuiKey_DownArrow);
+                    latency_total_ms[PerfNavCapture_Arrow] += vars.FrameDtMax * 1000.0;
+                }
+
+                vars.FrameDtMax = 0.0f;
+                ctx->KeyPress((move_n & 1) ? ImGuiKey_PageUp : ImGuiKey_PageDown);
+                latency_total_ms[PerfNavCapture_Page] += vars.FrameDtMax * 1000.0;
+            }
+
+            ctx->PerfCaptureValue("perf", names[PerfNavCapture_MoveTo], latency_total_ms[PerfNavCapture_MoveTo] / moves_count);
+            ctx->PerfCaptureValue("perf", names[PerfNavCapture_Arrow], latency_total_ms[PerfNavCapture_Arrow] / (moves_count * arrow_presses_per_move));
+            ctx->PerfCaptureValue("perf", names[PerfNavCapture_Page], latency_total_ms[PerfNavCapture_Page] / moves_count);
+        };
+
+        for (int layout = 0; layout < PerfNavLayout_COUNT; layout++)
+            for (int items_n = 0; items_n < IM_ARRAYSIZE(items_counts); items_n++)
+            {
+                for (int capture_n = 0; capture_n < PerfNavCapture_COUNT; capture_n++)
+                    ImFormatString(capture_names[layout][items_n][capture_n], IM_ARRAYSIZE(capture_names[layout][items_n][capture_n]), "perf_nav_%s_%s_%s", layout_names[layout], items_names[items_n], capture_suffixes[capture_n]);
+                t = IM_REGISTER_TEST(e, "perf", "");
+                t->SetOwnedName(Str64f("perf_nav_%s_%s", layout_names[layout], items_names[items_n]).c_str());
+                t->ArgVariant = layout | (items_n << 4);
+                t->SetVarsDataType<PerfNavVars>();
+                t->GuiFunc = gui_func;
+                t->TestFunc = test_func;
+            }
+    }
+
+#ifdef IMGUI_HAS_VIEWPORT
+    // ## "perf_viewports_XXX" tests: measure cost of 10/50/200 platform windows (e.g. with "-viewport-mock"), including
+    // UpdatePlatformWindows()/RenderPlatformWindowsDefault() called by the application.
+    // Windows are positioned outside of main viewport so each of them owns a viewport. They are moved by one pixel on every frame
+    // during "_move", and alternatively merged into main viewport and extracted during "_merge" (destroying/creating viewports).
+    // "_per_viewport" is the frame cost of "_static" divided by number of viewports.
+    if ((ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) && (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_PlatformHasViewports) && (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasViewports))
+    {
+        enum PerfViewportsPhase
+        {
+            PerfViewportsPhase_Static,
+            PerfViewportsPhase_Move,
+            PerfViewportsPhase_Merge,
+            PerfViewportsPhase_COUNT
+        };
+        struct PerfViewportsVars
+        {
+            int             Phase = PerfViewportsPhase_Static;
+            int             Frame = 0;
+            int             MergedCount = 0;
+        };
+        static const int windows_counts[] = { 10, 50, 200 };
+        const char* capture_suffixes[] = { "static", "move", "merge", "per_viewport" };
+
+        // Names are stored by perf tool, they need to be persistent.
+        static char capture_names[IM_ARRAYSIZE(windows_counts)][IM_ARRAYSIZE(capture_suffixes)][40];
+
+        for (int count_n = 0; count_n < IM_ARRAYSIZE(windows_counts); count_n++)
+        {
+            for (int capture_n = 0; capture_n < IM_ARRAYSIZE(capture_suffixes); capture_n++)
+                ImFormatString(capture_names[count_n][capture_n], IM_ARRAYSIZE(capture_names[count_n][capture_n]), "perf_viewports_%d_%s", windows_counts[count_n], capture_suffixes[capture_n]);
+
+            t = IM_REGISTER_TEST(e, "perf", "");
+            t->SetOwnedName(Str64f("perf_viewports_%d", windows_counts[count_n]).c_str());
+            t->ArgVariant = count_n;
+            t->SetVarsDataType<PerfViewportsVars>();
+            t->GuiFunc = [](ImGuiTestContext* ctx)
+            {
+                PerfViewportsVars& vars = ctx->GetVars<PerfViewportsVars>();
+                const int windows_count = windows_counts[ctx->Test->ArgVariant];
+                const bool merge = (vars.Phase == PerfViewportsPhase_Merge && (vars.Frame & 1));
+                ImGuiViewport* main_viewport = ImGui::GetMainViewport();
+                vars.Frame++;
+
+                for (int window_n = 0; window_n < windows_count; window_n++)
+                {
+                    const ImVec2 offset((window_n % 10) * 30.0f, (window_n / 10) * 40.0f);
+                    ImVec2 pos = merge ? main_viewport->WorkPos + ImVec2(20.0f, 20.0f) + offset : main_viewport->Pos + ImVec2(-600.0f, 0.0f) + offset;
+                    if (vars.Phase == PerfViewportsPhase_Move && (vars.Frame & 1))
+                        pos.x += 1.0f;
+                    ImGui::SetNextWindowPos(pos, ImGuiCond_Always);
+                    ImGui::SetNextWindowSize(ImVec2(280.0f, 200.0f), ImGuiCond_Always);
+                    ImGui::Begin(Str30f("Viewport Window %03d", window_n).c_str(), NULL, ImGuiWindowFlags_NoSavedSettings);
+                    if (merge && ImGui::GetWindowViewport() == main_viewport)
+                        vars.MergedCount++;
+                    ImGui::Text("Window %d", window_n);
+                    for (int line_n = 0; line_n < 8; line_n++)
+                        ImGui::Text("Line %d: The quick brown fox jumps over the lazy dog.", line_n);
+                    ImGui::Button("Button");
+                    ImGui::End();
+                }
+            };
+            t->TestFunc = [](ImGuiTestContext* ctx)
+            {
+                PerfViewportsVars& vars = ctx->GetVars<PerfViewportsVars>();
+                const int windows_count = windows_counts[ctx->Test->ArgVariant];
+                char (*names)[40] = capture_names[ctx->Test->ArgVariant];
+
+                ctx->Yield(2);
+                ImGuiWindow* window = ctx->GetWindowByRef("//Viewport Window 000");
+                IM_CHECK(window != NULL && window->ViewportOwned);
+                IM_CHECK_GE(ImGui::GetPlatformIO().Viewports.Size, windows_count + 1);
+
+                const int captures_start = ctx->Test->PerfCaptures.Size;
+                vars.Phase = PerfViewportsPhase_Static;
+                ctx->PerfCapture("perf", names[PerfViewportsPhase_Static]);
+                if (ctx->Test->PerfCaptures.Size == captures_start + 1)
+                    ctx->PerfCaptureValue("perf", names[PerfViewportsPhase_COUNT], ctx->Test->PerfCaptures.back().DtDeltaMs / windows_count);
+
+                vars.Phase = PerfViewportsPhase_Move;
+                ctx->PerfCapture("perf", names[PerfViewportsPhase_Move]);
+
+                vars.Phase = PerfViewportsPhase_Merge;
+                vars.MergedCount = 0;
+                ctx->PerfCapture("perf", names[PerfViewportsPhase_Merge]);
+                IM_CHECK_GT(vars.MergedCount, 0);
+
+                vars.Phase = PerfViewportsPhase_Static;
+                ctx->Yield(2);
+                IM_CHECK(window->ViewportOwned);
+            };
+        }
+    }
+#endif
+
+    // ## "perf_input_events_XXX" tests: measure input queue throughput with thousands of events submitted per frame
+    // (mouse moves, mouse wheel, key transitions, text characters), with and without io.ConfigInputTrickleEventQueue.
+    // A new burst is submitted from GuiFunc once previous one has been consumed (with trickling it takes multiple frames).
+    // NewFrame() is timed from a NewFramePre hook to the beginning of GuiFunc (which is called from test engine's NewFramePost hook).
+    // "_newframe" is the NewFrame() cost over "_idle" in ms, "_ns_event" is the processing cost per event in nanoseconds (lower is better, like other entries).
+    {
+        struct PerfInputEventsVars
+        {
+            bool        InjectEvents = false;
+            int         EventsCount = 0;                // Number of events per burst
+            int         QueueSizeBefore = 0;
+            ImU64       NewFrameStartNs = 0;
+            ImU64       NewFrameTotalNs = 0;
+            int         NewFrameCount = 0;
+            ImU64       EventsProcessed = 0;
+
+            void        ResetStats() { NewFrameTotalNs = 0; NewFrameCount = 0; EventsProcessed = 0; }
+        };
+        static const char* capture_names[2][4] =
+        {
+            { "perf_input_events_trickle_idle", "perf_input_events_trickle", "perf_input_events_trickle_newframe", "perf_input_events_trickle_ns_event" },
+            { "perf_input_events_no_trickle_idle", "perf_input_events_no_trickle", "perf_input_events_no_trickle_newframe", "perf_input_events_no_trickle_ns_event" },
+        };
+
+        auto gui_func = [](ImGuiTestContext* ctx)
+        {
+            PerfInputEventsVars& vars = ctx->GetVars<PerfInputEventsVars>();
+            ImGuiContext& g = *ctx->UiContext;
+            ImGuiIO& io = g.IO;
+
+            // End of NewFrame() measurement
+            if (vars.NewFrameStartNs != 0)
+            {
+                vars.NewFrameTotalNs += ImTimeGetInNanoseconds() - vars.NewFrameStartNs;
+                vars.NewFrameCount++;
+                vars.EventsProcessed += (ImU64)ImMax(vars.QueueSizeBefore - g.InputEventsQueue.Size, 0);
+                vars.NewFrameStartNs = 0;
+            }
+
+            if (!vars.InjectEvents || g.InputEventsQueue.Size > 0)
+                return;
+            const ImVec2 base_pos = ImGui::GetMainViewport()->Pos + ImVec2(100.0f, 100.0f);
+            for (int n = 0; n < vars.EventsCount / 4; n++)
+            {
+                io.AddMousePosEvent(base_pos.x + (float)(n % 200), base_pos.y + (float)((n / 200) % 200));
+                io.AddMouseWheelEvent(0.0f, (n & 1) ? -1.0f : +1.0f);
+                io.AddKeyEvent((ImGuiKey)(ImGuiKey_A + (n / 2) % 26), (n & 1) == 0); // Press then release each key
+                io.AddInputCharacter('a' + n % 26);
+            }
+
+            // Only events submitted by TestFunc are automatically preserved with ImGuiTestRunFlags_EnableRawInputs
+            for (ImGuiInputEvent& e : g.InputEventsQueue)
+                e.AddedByTestEngine = true;
+        };
+        auto test_func = [](ImGuiTestContext* ctx)
+        {
+            PerfInputEventsVars& vars = ctx->GetVars<PerfInputEventsVars>();
+            ImGuiContext& g = *ctx->UiContext;
+            const char** names = capture_names[ctx->Test->ArgVariant];
+
+            ctx->RunFlags |= ImGuiTestRunFlags_EnableRawInputs; // Disable TestEngine submitting inputs events
+            g.IO.ConfigInputTrickleEventQueue = (ctx->Test->ArgVariant == 0);
+            vars.EventsCount = 4000 * ctx->PerfStressAmount;
+            ctx->PerfCalcRef();
+
+            // Hook needs to be removed before any check may early out of this function.
+            ImGuiContextHook hook;
+            hook.Type = ImGuiContextHookType_NewFramePre;
+            hook.Callback = [](ImGuiContext* ui_ctx, ImGuiContextHook* hook)
+            {
+                PerfInputEventsVars& vars = *(PerfInputEventsVars*)hook->UserData;
+                vars.QueueSizeBefore = ui_ctx->InputEventsQueue.Size;
+                vars.NewFrameStartNs = ImTimeGetInNanoseconds();
+            };
+            hook.UserData = (void*)&vars;
+            const ImGuiID hook_id = ImGui::AddContextHook(&g, &hook);
+
+            vars.InjectEvents = false;
+            ctx->Yield();
+            vars.ResetStats();
+            ctx->PerfCapture("perf", names[0]);
+            const double newframe_idle_ns = vars.NewFrameCount ? (double)vars.NewFrameTotalNs / vars.NewFrameCount : 0.0;
+
+            vars.InjectEvents = true;
+            ctx->Yield();
+            vars.ResetStats();
+            ctx->PerfCapture("perf", names[1]);
+            vars.InjectEvents = false;
+            const double newframe_ns = vars.NewFrameCount ? (double)vars.NewFrameTotalNs / vars.NewFrameCount : 0.0;
+            const int frames_count = vars.NewFrameCount;
+            const ImU64 events_processed = vars.EventsProcessed;
+
+            ImGui::RemoveContextHook(&g, hook_id);
+            g.InputEventsQueue.resize(0); // Discard events not processed yet (with trickling)
+            ctx->Yield();
+
+            if (ctx->IsError() || frames_count == 0)
+                return;
+            IM_CHECK_GT(events_processed, (ImU64)0);
+            const double processing_ns = ImMax(newframe_ns - newframe_idle_ns, 0.0) * frames_count;
+            const double events_per_s = (processing_ns > 0.0) ? (double)events_processed * 1000000000.0 / processing_ns : 0.0;
+            ctx->LogInfo("[PERF] %d events per frame, NewFrame(): %.3f ms -> %.3f ms, %.0f events/s",
+                (int)(events_processed / (ImU64)frames_count), newframe_idle_ns / 1000000.0, newframe_ns / 1000000.0, events_per_s);
+            ctx->PerfCaptureValue("perf", names[2], (newframe_ns - newframe_idle_ns) / 1000000.0);
+            ctx->PerfCaptureValue("perf", names[3], processing_ns / (double)events_processed);
+        };
+
+        t = IM_REGISTER_TEST(e, "perf", "perf_input_events_trickle");
+        t->SetVarsDataType<PerfInputEventsVars>();
+        t->ArgVariant = 0;
+        t->GuiFunc = gui_func;
+        t->TestFunc = test_func;
+
+        t = IM_REGISTER_TEST(e, "perf", "perf_input_events_no_trickle");
+        t->SetVarsDataType<PerfInputEventsVars>();
+        t->ArgVariant = 1;
+        t->GuiFunc = gui_func;
+        t->TestFunc = test_func;
+    }
+
+    // ## "microbench_XXX" tests: micro-benchmarks of low-level functions (ImGuiTestGroup_MicroBenchs).
+    // Kernels are called back-to-back within a single frame by ctx->MicroBench(), which reports ns/op and Mops/s to the perf log.
+    {
+        // Draw list kernels are run on a standalone draw list, which is reset between batches.
+        t = IM_REGISTER_TEST(e, "microbench", "microbench_draw_list");
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            ImDrawList draw_list(ImGui::GetDrawListSharedData());
+            auto reset_func = [](void* user_data)
+            {
+                ImDrawList* draw_list = (ImDrawList*)user_data;
+                draw_list->_ResetForNewFrame();
+                draw_list->PushClipRectFullScreen();
+                draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+            };
+            ctx->MicroBench("microbench_draw_add_line", [](void* user_data)
+            {
+                ((ImDrawList*)user_data)->AddLine(ImVec2(10.0f, 10.0f), ImVec2(200.0f, 50.0f), IM_COL32_WHITE, 1.0f);
+            }, reset_func, &draw_list);
+            ctx->MicroBench("microbench_draw_add_rect", [](void* user_data)
+            {
+                ((ImDrawList*)user_data)->AddRect(ImVec2(10.0f, 10.0f), ImVec2(200.0f, 50.0f), IM_COL32_WHITE);
+            }, reset_func, &draw_list);
+            ctx->MicroBench("microbench_draw_add_text", [](void* user_data)
+            {
+                ((ImDrawList*)user_data)->AddText(ImVec2(10.0f, 10.0f), IM_COL32_WHITE, "Hello, world!");
+            }, reset_func, &draw_list);
+            ctx->MicroBench("microbench_draw_channels_split_merge", [](void* user_data)
+            {
+                ImDrawList* draw_list = (ImDrawList*)user_data;
+                draw_list->ChannelsSplit(4);
+                for (int channel_n = 3; channel_n >= 0; channel_n--)
+                {
+                    draw_list->ChannelsSetCurrent(channel_n);
+                    draw_list->AddRectFilled(ImVec2(10.0f, 10.0f + channel_n * 20.0f), ImVec2(200.0f, 25.0f + channel_n * 20.0f), IM_COL32_WHITE);
+                }
+                draw_list->ChannelsMerge();
+            }, reset_func, &draw_list);
+            ctx->MicroBench("microbench_draw_prim_reserve", [](void* user_data)
+            {
+                ImDrawList* draw_list = (ImDrawList*)user_data;
+                draw_list->PrimReserve(6, 4);
+                draw_list->PrimRect(ImVec2(10.0f, 10.0f), ImVec2(200.0f, 50.0f), IM_COL32_WHITE);
+            }, reset_func, &draw_list);
+        };
+
+        t = IM_REGISTER_TEST(e, "microbench", "microbench_hash_str");
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            // Pass strings through user_data so the compiler cannot see them.
+            static const char* str_short = "Button";
+            static const char* str_long = "Dear ImGui Demo/##Child_1234/Widgets/Basic/##Combo_Hashed###Some Long Label";
+            ctx->MicroBench("microbench_hash_str_short", [](void* user_data) { ImDoNotOptimize(ImHashStr((const char*)user_data)); }, NULL, (void*)str_short);
+            ctx->MicroBench("microbench_hash_str_long", [](void* user_data) { ImDoNotOptimize(ImHashStr((const char*)user_data)); }, NULL, (void*)str_long);
+        };
+
+        t = IM_REGISTER_TEST(e, "microbench", "microbench_calc_text_size");
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            static const char* str_short = "Hello, world!";
+            static const char* str_long = "The quick brown fox jumps over the lazy dog.\nPack my box with five dozen liquor jugs.\nSphinx of black quartz, judge my vow.";
+            ctx->MicroBench("microbench_calc_text_size_short", [](void* user_data) { ImDoNotOptimize(ImGui::CalcTextSize((const char*)user_data)); }, NULL, (void*)str_short);
+            ctx->MicroBench("microbench_calc_text_size_long", [](void* user_data) { ImDoNotOptimize(ImGui::CalcTextSize((const char*)user_data)); }, NULL, (void*)str_long);
+            ctx->MicroBench("microbench_calc_text_size_wrapped", [](void* user_data) { ImDoNotOptimize(ImGui::CalcTextSize((const char*)user_data, NULL, false, 100.0f)); }, NULL, (void*)str_long);
+        };
+    }
+
+    // ## "perf_capture_image_ops_XXXX" tests: measure pixel operations used by capture tool, on a 1920x1080 image
+    {
+        struct PerfImageOpsVars
+        {
+            ImGuiCaptureImageBuf Src;
+            ImGuiCaptureImageBuf Dst;
+        };
+        enum PerfImageOp
+        {
+            PerfImageOp_FillAlpha,
+            PerfImageOp_SwizzleRB,
+            PerfImageOp_FlipVertical,
+            PerfImageOp_Crop,
+            PerfImageOp_Downscale,
+            PerfImageOp_Premultiply,
+            PerfImageOp_COUNT
+        };
+        const char* op_names[] = { "fill_alpha", "swizzle_rb", "flip_vertical", "crop", "downscale", "premultiply" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(op_names) == PerfImageOp_COUNT);
+        for (int op = 0; op < PerfImageOp_COUNT; op++)
+        {
+            t = IM_REGISTER_TEST(e, "perf", "");
+            t->SetOwnedName(Str64f("perf_capture_image_ops_%s", op_names[op]).c_str());
+            t->ArgVariant = op;
+            t->SetVarsDataType<PerfImageOpsVars>([](ImGuiTestContext* ctx, PerfImageOpsVars& vars)
+            {
+                const int w = 1920, h = 1080;
+                vars.Src.CreateEmpty(w, h);
+                for (int n = 0; n < w * h; n++)
+                    vars.Src.Data[n] = (2166136261u ^ (unsigned int)n) * 16777619u;
+                vars.Dst.CreateEmpty(w, h);
+            });
+            t->GuiFunc = [](ImGuiTestContext* ctx)
+            {
+                PerfImageOpsVars& vars = ctx->GetVars<PerfImageOpsVars>();
+                ImGuiCaptureImageBuf* src = &vars.Src;
+                ImGuiCaptureImageBuf* dst = &vars.Dst;
+                const size_t count = (size_t)src->Width * (size_t)src->Height;
+                for (int n = 0; n < ctx->PerfStressAmount; n++)
+                {
+                    switch (ctx->Test->ArgVariant)
+                    {
+                    case PerfImageOp_FillAlpha:     ImGuiCaptureImageOps_FillAlpha(dst->Data, count, 0xFF); break;
+                    case PerfImageOp_SwizzleRB:     ImGuiCaptureImageOps_SwizzleRB(dst->Data, src->Data, count); break;
+                    case PerfImageOp_FlipVertical:  ImGuiCaptureImageOps_FlipVertical(dst->Data, dst->Width, dst->Height, dst->Width); break;
+                    case PerfImageOp_Crop:          ImGuiCaptureImageOps_Blit(dst->Data, dst->Width, src->Data + src->Width * 100 + 100, src->Width, src->Width - 200, src->Height - 200); break;
+                    case PerfImageOp_Downscale:     ImGuiCaptureImageOps_DownscaleBox(dst->Data, dst->Width, src->Data, src->Width, src->Width, src->Height, 2); break;
+                    case PerfImageOp_Premultiply:   ImGuiCaptureImageOps_Premultiply(dst->Data, src->Data, count); break;
+                    }
+                }
+                ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+                ImGui::Text("Pixel %08X", dst->Data[dst->Width * 10 + 10]); // Use output
+                ImGui::End();
+            };
+            t->TestFunc = PerfCaptureFunc;
+        }
+    }
 }
 
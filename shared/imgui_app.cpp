@@ -33,6 +33,10 @@
 #include "imgui.h"
 #include "imgui_internal.h"
 #include <chrono>   // time_since_epoch
+#include <thread>   // Software renderer
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #ifdef __linux__
 #include <unistd.h> // sleep
 #endif
@@ -43,6 +47,7 @@ Index of this file:
 
 // [SECTION] Defines
 // [SECTION] ImGuiApp Implementation: NULL
+// [SECTION] ImGuiApp Implementation: NULL + Software Renderer
 // [SECTION] ImGuiApp Implementation: Win32 + DX11
 // [SECTION] ImGuiApp Implementation: SDL + OpenGL2
 // [SECTION] ImGuiApp Implementation: SDL + OpenGL3
@@ -168,6 +173,10 @@ static bool ImGuiApp_ImplNull_NewFrame(ImGuiApp* app_opaque)
         io.DeltaTime = 0.000001f;
     app->LastTime = time;
 
+    // Deterministic clock (e.g. running tests with a virtual clock). Keep LastTime updated so switching back doesn't produce a large delta.
+    if (app->FixedDeltaTime > 0.0f)
+        io.DeltaTime = app->FixedDeltaTime;
+
     return true;
 }
 
@@ -229,6 +238,511 @@ ImGuiApp* ImGuiApp_ImplNull_Create()
     return intf;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiApp Implementation: NULL + Software Renderer
+//-----------------------------------------------------------------------------
+// Same as NULL backend, but ImDrawData is rasterized on CPU into a framebuffer so screen captures work without a GPU.
+// - Vertices are snapped to 1/16th of a pixel and edge functions are evaluated with integers, with a top-left fill rule:
+//   pixels on an edge shared by two triangles (e.g. quads) are drawn exactly once.
+// - Triangles are binned into 64x64 pixel tiles. Tiles are rasterized in parallel, each tile in submission order.
+// - Blending matches Dear ImGui backends: src.rgb * src.a + dst.rgb * (1 - src.a). Texture sampling is nearest neighbor.
+// - Only the font atlas texture is supported: other textures are sampled as opaque white.
+// - Only main viewport is rendered (other viewports are handled as in NULL backend).
+//-----------------------------------------------------------------------------
+
+#define IMGUI_APP_SOFTWARE_SUBPIXEL_BITS    4
+#define IMGUI_APP_SOFTWARE_TILE_SIZE        64
+
+// Data
+struct ImGuiApp_ImplSoftwareTexture
+{
+    int                 Width = 0;
+    int                 Height = 0;
+    ImVector<ImU32>     Pixels;                 // IM_COL32() format
+};
+
+enum ImGuiApp_ImplSoftwareShade
+{
+    ImGuiApp_ImplSoftwareShade_Solid,           // Constant color and texel: precomputed in SolidColor
+    ImGuiApp_ImplSoftwareShade_Textured,        // Constant color, interpolated UV (e.g. text)
+    ImGuiApp_ImplSoftwareShade_Gouraud,         // Interpolated color, constant texel (e.g. anti-aliased fringes, gradients)
+    ImGuiApp_ImplSoftwareShade_Full             // Interpolated color and UV
+};
+
+struct ImGuiApp_ImplSoftwareTriangle
+{
+    int                 X[3], Y[3];             // Fixed point position in framebuffer, counter-clockwise (in y-down space)
+    ImVec2              UV[3];
+    ImU32               Col[3];
+    ImU32               SolidColor;
+    int                 MinX, MinY, MaxX, MaxY; // Pixel bounding box, intersected with clip rectangle and framebuffer. Max is exclusive.
+    const ImGuiApp_ImplSoftwareTexture* Texture;
+    ImGuiApp_ImplSoftwareShade Shade;
+};
+
+struct ImGuiApp_ImplSoftware : public ImGuiApp_ImplNull
+{
+    ImGuiApp_ImplSoftwareTexture            FontTexture;
+    ImVector<ImU32>                         Framebuffer;            // IM_COL32() format
+    int                                     FramebufferWidth = 0;
+    int                                     FramebufferHeight = 0;
+    ImU32                                   FramebufferClearColor = 0;
+    ImVector<ImGuiApp_ImplSoftwareTriangle> Triangles;
+    ImVector<int>                           TileTrianglesStart;     // For each tile, offset in TileTriangles[] (+ one extra element)
+    ImVector<int>                           TileTriangles;          // Triangle indices, grouped by tile
+    ImVector<int>                           TileTrianglesWritePos;  // Temporary while binning
+    int                                     TilesX = 0;
+    int                                     TilesY = 0;
+
+    // Worker threads (main thread rasterizes tiles as well)
+    ImVector<std::thread*>                  Threads;
+    std::mutex                              Mutex;
+    std::condition_variable                 WorkCond;
+    std::condition_variable                 DoneCond;
+    int                                     WorkGeneration = 0;     // Incremented for each frame to rasterize
+    int                                     WorkersBusy = 0;
+    bool                                    WorkersQuit = false;
+    std::atomic<int>                        TileNext;
+};
+
+// Functions
+static inline ImU32 ImGuiApp_ImplSoftware_MulColors(ImU32 a, ImU32 b)
+{
+    if (a == IM_COL32_WHITE)
+        return b;
+    if (b == IM_COL32_WHITE)
+        return a;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ((((a >> shift) & 0xFF) * ((b >> shift) & 0xFF) + 127) / 255) << shift;
+    return out;
+}
+
+// Straight alpha blending, alpha channel as (src.a + dst.a * (1 - src.a)). Blends two channels at a time.
+static inline ImU32 ImGuiApp_ImplSoftware_Blend(ImU32 dst, ImU32 src)
+{
+    const ImU32 src_a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (src_a == 0xFF)
+        return src;
+    if (src_a == 0)
+        return dst;
+    const ImU32 inv_a = 255 - src_a;
+    ImU32 rb = (src & 0x00FF00FF) * src_a + (dst & 0x00FF00FF) * inv_a;
+    ImU32 ga = ((src >> 8) & 0x00FF00FF) * src_a + ((dst >> 8) & 0x00FF00FF) * inv_a;
+    rb = ((rb + 0x00800080 + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    ga = ((ga + 0x00800080 + ((ga >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    const ImU32 dst_a = (dst >> IM_COL32_A_SHIFT) & 0xFF;
+    const ImU32 out_a = src_a + (dst_a * inv_a + 127) / 255;
+    return ((rb | (ga << 8)) & ~IM_COL32_A_MASK) | (out_a << IM_COL32_A_SHIFT);
+}
+
+static inline ImU32 ImGuiApp_ImplSoftware_SampleTexture(const ImGuiApp_ImplSoftwareTexture* tex, float u, float v)
+{
+    if (tex == NULL)
+        return IM_COL32_WHITE;
+    const int x = ImClamp((int)(u * tex->Width), 0, tex->Width - 1);
+    const int y = ImClamp((int)(v * tex->Height), 0, tex->Height - 1);
+    return tex->Pixels.Data[y * tex->Width + x];
+}
+
+static inline ImU32 ImGuiApp_ImplSoftware_PackColor(const ImVec4& c)
+{
+    const ImU32 r = (ImU32)(c.x + 0.5f);
+    const ImU32 g = (ImU32)(c.y + 0.5f);
+    const ImU32 b = (ImU32)(c.z + 0.5f);
+    const ImU32 a = (ImU32)(c.w + 0.5f);
+    return (ImMin(r, 255u) << IM_COL32_R_SHIFT) | (ImMin(g, 255u) << IM_COL32_G_SHIFT) | (ImMin(b, 255u) << IM_COL32_B_SHIFT) | (ImMin(a, 255u) << IM_COL32_A_SHIFT);
+}
+
+// Unpack to [0,255] floats, each channel multiplied by 'scale'
+static inline ImVec4 ImGuiApp_ImplSoftware_UnpackColor(ImU32 col, const ImVec4& scale)
+{
+    return ImVec4((float)((col >> IM_COL32_R_SHIFT) & 0xFF) * scale.x, (float)((col >> IM_COL32_G_SHIFT) & 0xFF) * scale.y, (float)((col >> IM_COL32_B_SHIFT) & 0xFF) * scale.z, (float)((col >> IM_COL32_A_SHIFT) & 0xFF) * scale.w);
+}
+
+// Rasterize the part of a triangle which overlaps [x0,x1)*[y0,y1).
+static void ImGuiApp_ImplSoftware_RasterizeTriangle(ImGuiApp_ImplSoftware* app, const ImGuiApp_ImplSoftwareTriangle* tri, int x0, int y0, int x1, int y1)
+{
+    const ImS64 sub = 1 << IMGUI_APP_SOFTWARE_SUBPIXEL_BITS;
+
+    // Edge functions: e(p) = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x), evaluated at pixel centers.
+    // Edges 0/1/2 are opposite to vertices 0/1/2. A pixel exactly on an edge is drawn when the edge is top-left.
+    ImS64 step_x[3], step_y[3], row[3];
+    const ImS64 px = (ImS64)x0 * sub + sub / 2;
+    const ImS64 py = (ImS64)y0 * sub + sub / 2;
+    for (int e = 0; e < 3; e++)
+    {
+        const int a = (e + 1) % 3;
+        const int b = (e + 2) % 3;
+        const ImS64 dx = tri->X[b] - tri->X[a];
+        const ImS64 dy = tri->Y[b] - tri->Y[a];
+        const bool top_left = (dy < 0) || (dy == 0 && dx > 0);
+        step_x[e] = -dy * sub;
+        step_y[e] = dx * sub;
+        row[e] = dx * (py - tri->Y[a]) - dy * (px - tri->X[a]) - (top_left ? 0 : 1);
+    }
+    const ImS64 area = (ImS64)(tri->X[1] - tri->X[0]) * (tri->Y[2] - tri->Y[0]) - (ImS64)(tri->Y[1] - tri->Y[0]) * (tri->X[2] - tri->X[0]);
+    const float inv_area = 1.0f / (float)area; // Top-left bias is negligible in barycentric coordinates
+
+    // Attributes are interpolated with barycentric coordinates l1/l2 (l0 = 1 - l1 - l2), computed at start of each row
+    // then stepped by a constant amount per pixel. Constant texel of Gouraud shading is folded into vertex colors.
+    const ImGuiApp_ImplSoftwareShade shade = tri->Shade;
+    const float dl1_dx = (float)step_x[1] * inv_area;
+    const float dl2_dx = (float)step_x[2] * inv_area;
+    const ImVec2 uv0 = tri->UV[0];
+    const ImVec2 duv1(tri->UV[1].x - uv0.x, tri->UV[1].y - uv0.y);
+    const ImVec2 duv2(tri->UV[2].x - uv0.x, tri->UV[2].y - uv0.y);
+    const ImVec2 duv_dx(duv1.x * dl1_dx + duv2.x * dl2_dx, duv1.y * dl1_dx + duv2.y * dl2_dx);
+    ImVec4 col_scale(1.0f, 1.0f, 1.0f, 1.0f);
+    if (shade == ImGuiApp_ImplSoftwareShade_Gouraud)
+        col_scale = ImGuiApp_ImplSoftware_UnpackColor(ImGuiApp_ImplSoftware_SampleTexture(tri->Texture, uv0.x, uv0.y), ImVec4(1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f));
+    const ImVec4 c0 = ImGuiApp_ImplSoftware_UnpackColor(tri->Col[0], col_scale);
+    const ImVec4 c1 = ImGuiApp_ImplSoftware_UnpackColor(tri->Col[1], col_scale);
+    const ImVec4 c2 = ImGuiApp_ImplSoftware_UnpackColor(tri->Col[2], col_scale);
+    const ImVec4 dc1(c1.x - c0.x, c1.y - c0.y, c1.z - c0.z, c1.w - c0.w);
+    const ImVec4 dc2(c2.x - c0.x, c2.y - c0.y, c2.z - c0.z, c2.w - c0.w);
+    const ImVec4 dc_dx(dc1.x * dl1_dx + dc2.x * dl2_dx, dc1.y * dl1_dx + dc2.y * dl2_dx, dc1.z * dl1_dx + dc2.z * dl2_dx, dc1.w * dl1_dx + dc2.w * dl2_dx);
+    const bool tint_texels = (tri->Col[0] != IM_COL32_WHITE);
+
+    ImU32* fb_row = app->Framebuffer.Data + (size_t)y0 * app->FramebufferWidth;
+    for (int y = y0; y < y1; y++, fb_row += app->FramebufferWidth)
+    {
+        ImS64 w0 = row[0], w1 = row[1], w2 = row[2];
+        const float l1 = (float)w1 * inv_area;
+        const float l2 = (float)w2 * inv_area;
+        ImVec2 uv(uv0.x + duv1.x * l1 + duv2.x * l2, uv0.y + duv1.y * l1 + duv2.y * l2);
+        ImVec4 col(c0.x + dc1.x * l1 + dc2.x * l2, c0.y + dc1.y * l1 + dc2.y * l2, c0.z + dc1.z * l1 + dc2.z * l2, c0.w + dc1.w * l1 + dc2.w * l2);
+        switch (shade)
+        {
+        case ImGuiApp_ImplSoftwareShade_Solid:
+            for (int x = x0; x < x1; x++, w0 += step_x[0], w1 += step_x[1], w2 += step_x[2])
+                if ((w0 | w1 | w2) >= 0)
+                    fb_row[x] = ImGuiApp_ImplSoftware_Blend(fb_row[x], tri->SolidColor);
+            break;
+        case ImGuiApp_ImplSoftwareShade_Textured:
+            for (int x = x0; x < x1; x++, w0 += step_x[0], w1 += step_x[1], w2 += step_x[2], uv.x += duv_dx.x, uv.y += duv_dx.y)
+                if ((w0 | w1 | w2) >= 0)
+                {
+                    const ImU32 texel = ImGuiApp_ImplSoftware_SampleTexture(tri->Texture, uv.x, uv.y);
+                    fb_row[x] = ImGuiApp_ImplSoftware_Blend(fb_row[x], tint_texels ? ImGuiApp_ImplSoftware_MulColors(tri->Col[0], texel) : texel);
+                }
+            break;
+        case ImGuiApp_ImplSoftwareShade_Gouraud:
+            for (int x = x0; x < x1; x++, w0 += step_x[0], w1 += step_x[1], w2 += step_x[2], col.x += dc_dx.x, col.y += dc_dx.y, col.z += dc_dx.z, col.w += dc_dx.w)
+                if ((w0 | w1 | w2) >= 0)
+                    fb_row[x] = ImGuiApp_ImplSoftware_Blend(fb_row[x], ImGuiApp_ImplSoftware_PackColor(col));
+            break;
+        case ImGuiApp_ImplSoftwareShade_Full:
+            for (int x = x0; x < x1; x++, w0 += step_x[0], w1 += step_x[1], w2 += step_x[2], uv.x += duv_dx.x, uv.y += duv_dx.y, col.x += dc_dx.x, col.y += dc_dx.y, col.z += dc_dx.z, col.w += dc_dx.w)
+                if ((w0 | w1 | w2) >= 0)
+                    fb_row[x] = ImGuiApp_ImplSoftware_Blend(fb_row[x], ImGuiApp_ImplSoftware_MulColors(ImGuiApp_ImplSoftware_PackColor(col), ImGuiApp_ImplSoftware_SampleTexture(tri->Texture, uv.x, uv.y)));
+            break;
+        }
+        row[0] += step_y[0];
+        row[1] += step_y[1];
+        row[2] += step_y[2];
+    }
+}
+
+static void ImGuiApp_ImplSoftware_RasterizeTile(ImGuiApp_ImplSoftware* app, int tile_n)
+{
+    const int x0 = (tile_n % app->TilesX) * IMGUI_APP_SOFTWARE_TILE_SIZE;
+    const int y0 = (tile_n / app->TilesX) * IMGUI_APP_SOFTWARE_TILE_SIZE;
+    const int x1 = ImMin(x0 + IMGUI_APP_SOFTWARE_TILE_SIZE, app->FramebufferWidth);
+    const int y1 = ImMin(y0 + IMGUI_APP_SOFTWARE_TILE_SIZE, app->FramebufferHeight);
+
+    // Clear
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* fb_row = app->Framebuffer.Data + (size_t)y * app->FramebufferWidth;
+        for (int x = x0; x < x1; x++)
+            fb_row[x] = app->FramebufferClearColor;
+    }
+
+    // Rasterize triangles in submission order
+    for (int n = app->TileTrianglesStart[tile_n]; n < app->TileTrianglesStart[tile_n + 1]; n++)
+    {
+        const ImGuiApp_ImplSoftwareTriangle* tri = &app->Triangles.Data[app->TileTriangles.Data[n]];
+        ImGuiApp_ImplSoftware_RasterizeTriangle(app, tri, ImMax(x0, tri->MinX), ImMax(y0, tri->MinY), ImMin(x1, tri->MaxX), ImMin(y1, tri->MaxY));
+    }
+}
+
+static void ImGuiApp_ImplSoftware_RasterizeTiles(ImGuiApp_ImplSoftware* app)
+{
+    const int tiles_count = app->TilesX * app->TilesY;
+    for (int tile_n = app->TileNext++; tile_n < tiles_count; tile_n = app->TileNext++)
+        ImGuiApp_ImplSoftware_RasterizeTile(app, tile_n);
+}
+
+static void ImGuiApp_ImplSoftware_ThreadMain(ImGuiApp_ImplSoftware* app)
+{
+    int generation = 0;
+    std::unique_lock<std::mutex> lock(app->Mutex);
+    while (true)
+    {
+        app->WorkCond.wait(lock, [&]() { return app->WorkersQuit || app->WorkGeneration != generation; });
+        if (app->WorkersQuit)
+            return;
+        generation = app->WorkGeneration;
+        lock.unlock();
+        ImGuiApp_ImplSoftware_RasterizeTiles(app);
+        lock.lock();
+        if (--app->WorkersBusy == 0)
+            app->DoneCond.notify_one();
+    }
+}
+
+static void ImGuiApp_ImplSoftware_InitBackends(ImGuiApp* app_opaque)
+{
+    ImGuiApp_ImplSoftware* app = (ImGuiApp_ImplSoftware*)app_opaque;
+    ImGuiApp_ImplNull_InitBackends(app);
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_app_software";
+
+    int threads_count = (app->SoftwareRendererThreads > 0) ? app->SoftwareRendererThreads : (int)std::thread::hardware_concurrency();
+    for (int thread_n = 1; thread_n < threads_count; thread_n++) // Main thread is also rasterizing
+        app->Threads.push_back(new std::thread(ImGuiApp_ImplSoftware_ThreadMain, app));
+}
+
+static void ImGuiApp_ImplSoftware_ShutdownBackends(ImGuiApp* app_opaque)
+{
+    ImGuiApp_ImplSoftware* app = (ImGuiApp_ImplSoftware*)app_opaque;
+    {
+        std::lock_guard<std::mutex> lock(app->Mutex);
+        app->WorkersQuit = true;
+    }
+    app->WorkCond.notify_all();
+    for (std::thread* thread : app->Threads)
+    {
+        thread->join();
+        delete thread;
+    }
+    app->Threads.clear();
+    app->WorkersQuit = false;
+
+    ImGuiIO& io = ImGui::GetIO();
+    if (io.Fonts->TexID == (ImTextureID)(intptr_t)&app->FontTexture)
+        io.Fonts->SetTexID((ImTextureID)0);
+    io.BackendRendererName = NULL;
+}
+
+static bool ImGuiApp_ImplSoftware_NewFrame(ImGuiApp* app_opaque)
+{
+    ImGuiApp_ImplSoftware* app = (ImGuiApp_ImplSoftware*)app_opaque;
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Create font texture, again when fonts are added after initialization
+    if (io.Fonts->TexID != (ImTextureID)(intptr_t)&app->FontTexture || !io.Fonts->IsBuilt())
+    {
+        unsigned char* pixels = NULL;
+        int width = 0, height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        ImGuiApp_ImplSoftwareTexture* tex = &app->FontTexture;
+        tex->Width = width;
+        tex->Height = height;
+        tex->Pixels.resize(width * height);
+        for (int n = 0; n < width * height; n++, pixels += 4)
+            tex->Pixels[n] = IM_COL32(pixels[0], pixels[1], pixels[2], pixels[3]);
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)tex);
+    }
+
+    return ImGuiApp_ImplNull_NewFrame(app);
+}
+
+// Snap vertices, compute clipped bounding boxes and shading mode.
+static void ImGuiApp_ImplSoftware_SetupTriangles(ImGuiApp_ImplSoftware* app, ImDrawData* draw_data)
+{
+    const float sub = (float)(1 << IMGUI_APP_SOFTWARE_SUBPIXEL_BITS);
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    app->Triangles.resize(0);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Same scissor rectangle as GL backends, clamped to framebuffer
+            const ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            const ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int clip_x0 = ImMax((int)clip_min.x, 0);
+            const int clip_y0 = ImMax((int)clip_min.y, 0);
+            const int clip_x1 = ImMin((int)clip_min.x + (int)(clip_max.x - clip_min.x), app->FramebufferWidth);
+            const int clip_y1 = ImMin((int)clip_min.y + (int)(clip_max.y - clip_min.y), app->FramebufferHeight);
+            if (clip_x1 <= clip_x0 || clip_y1 <= clip_y0)
+                continue;
+
+            const ImGuiApp_ImplSoftwareTexture* tex = (pcmd->TextureId == (ImTextureID)(intptr_t)&app->FontTexture) ? &app->FontTexture : NULL;
+            const ImDrawIdx* idx = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            const ImDrawVert* vtx = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            for (unsigned int elem_n = 0; elem_n + 2 < pcmd->ElemCount; elem_n += 3)
+            {
+                ImGuiApp_ImplSoftwareTriangle tri;
+                const ImDrawVert* v[3] = { &vtx[idx[elem_n]], &vtx[idx[elem_n + 1]], &vtx[idx[elem_n + 2]] };
+                for (int k = 0; k < 3; k++)
+                {
+                    tri.X[k] = (int)ImFloor((v[k]->pos.x - clip_off.x) * clip_scale.x * sub + 0.5f);
+                    tri.Y[k] = (int)ImFloor((v[k]->pos.y - clip_off.y) * clip_scale.y * sub + 0.5f);
+                    tri.UV[k] = v[k]->uv;
+                    tri.Col[k] = v[k]->col;
+                }
+
+                // Dear ImGui doesn't rely on culling: accept both orientations
+                const ImS64 area = (ImS64)(tri.X[1] - tri.X[0]) * (tri.Y[2] - tri.Y[0]) - (ImS64)(tri.Y[1] - tri.Y[0]) * (tri.X[2] - tri.X[0]);
+                if (area == 0)
+                    continue;
+                if (area < 0)
+                {
+                    ImSwap(tri.X[1], tri.X[2]);
+                    ImSwap(tri.Y[1], tri.Y[2]);
+                    ImSwap(tri.UV[1], tri.UV[2]);
+                    ImSwap(tri.Col[1], tri.Col[2]);
+                }
+
+                // Pixels whose center may be covered
+                const int sub_half = 1 << (IMGUI_APP_SOFTWARE_SUBPIXEL_BITS - 1);
+                tri.MinX = ImMax(clip_x0, (ImMin(ImMin(tri.X[0], tri.X[1]), tri.X[2]) - sub_half) >> IMGUI_APP_SOFTWARE_SUBPIXEL_BITS);
+                tri.MinY = ImMax(clip_y0, (ImMin(ImMin(tri.Y[0], tri.Y[1]), tri.Y[2]) - sub_half) >> IMGUI_APP_SOFTWARE_SUBPIXEL_BITS);
+                tri.MaxX = ImMin(clip_x1, ((ImMax(ImMax(tri.X[0], tri.X[1]), tri.X[2]) - sub_half) >> IMGUI_APP_SOFTWARE_SUBPIXEL_BITS) + 1);
+                tri.MaxY = ImMin(clip_y1, ((ImMax(ImMax(tri.Y[0], tri.Y[1]), tri.Y[2]) - sub_half) >> IMGUI_APP_SOFTWARE_SUBPIXEL_BITS) + 1);
+                if (tri.MaxX <= tri.MinX || tri.MaxY <= tri.MinY)
+                    continue;
+
+                const bool same_col = (tri.Col[0] == tri.Col[1] && tri.Col[0] == tri.Col[2]);
+                const bool same_uv = (tri.UV[0].x == tri.UV[1].x && tri.UV[0].x == tri.UV[2].x && tri.UV[0].y == tri.UV[1].y && tri.UV[0].y == tri.UV[2].y) || (tex == NULL);
+                if (same_col && (tri.Col[0] & IM_COL32_A_MASK) == 0)
+                    continue;
+                tri.Texture = tex;
+                tri.Shade = same_col ? (same_uv ? ImGuiApp_ImplSoftwareShade_Solid : ImGuiApp_ImplSoftwareShade_Textured) : (same_uv ? ImGuiApp_ImplSoftwareShade_Gouraud : ImGuiApp_ImplSoftwareShade_Full);
+                tri.SolidColor = ImGuiApp_ImplSoftware_MulColors(tri.Col[0], ImGuiApp_ImplSoftware_SampleTexture(tex, tri.UV[0].x, tri.UV[0].y));
+                app->Triangles.push_back(tri);
+            }
+        }
+    }
+}
+
+// Sort triangle indices by tile with a counting pass (triangle order is preserved within each tile).
+static void ImGuiApp_ImplSoftware_BinTriangles(ImGuiApp_ImplSoftware* app)
+{
+    const int tiles_count = app->TilesX * app->TilesY;
+    app->TileTrianglesStart.resize(tiles_count + 1);
+    memset(app->TileTrianglesStart.Data, 0, (size_t)app->TileTrianglesStart.size_in_bytes());
+    for (const ImGuiApp_ImplSoftwareTriangle& tri : app->Triangles)
+        for (int ty = tri.MinY / IMGUI_APP_SOFTWARE_TILE_SIZE; ty <= (tri.MaxY - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE; ty++)
+            for (int tx = tri.MinX / IMGUI_APP_SOFTWARE_TILE_SIZE; tx <= (tri.MaxX - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE; tx++)
+                app->TileTrianglesStart[ty * app->TilesX + tx + 1]++;
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+        app->TileTrianglesStart[tile_n + 1] += app->TileTrianglesStart[tile_n];
+
+    app->TileTriangles.resize(app->TileTrianglesStart[tiles_count]);
+    ImVector<int>& tile_write_pos = app->TileTrianglesWritePos;
+    tile_write_pos.resize(tiles_count);
+    memcpy(tile_write_pos.Data, app->TileTrianglesStart.Data, (size_t)tile_write_pos.size_in_bytes());
+    for (int tri_n = 0; tri_n < app->Triangles.Size; tri_n++)
+    {
+        const ImGuiApp_ImplSoftwareTriangle& tri = app->Triangles[tri_n];
+        for (int ty = tri.MinY / IMGUI_APP_SOFTWARE_TILE_SIZE; ty <= (tri.MaxY - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE; ty++)
+            for (int tx = tri.MinX / IMGUI_APP_SOFTWARE_TILE_SIZE; tx <= (tri.MaxX - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE; tx++)
+                app->TileTriangles[tile_write_pos[ty * app->TilesX + tx]++] = tri_n;
+    }
+}
+
+static void ImGuiApp_ImplSoftware_RenderDrawData(ImGuiApp_ImplSoftware* app, ImDrawData* draw_data)
+{
+    const int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    const int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+    if (app->FramebufferWidth != fb_width || app->FramebufferHeight != fb_height)
+    {
+        app->FramebufferWidth = fb_width;
+        app->FramebufferHeight = fb_height;
+        app->Framebuffer.resize(fb_width * fb_height);
+        app->TilesX = (fb_width + IMGUI_APP_SOFTWARE_TILE_SIZE - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE;
+        app->TilesY = (fb_height + IMGUI_APP_SOFTWARE_TILE_SIZE - 1) / IMGUI_APP_SOFTWARE_TILE_SIZE;
+    }
+    app->FramebufferClearColor = ImGui::ColorConvertFloat4ToU32(app->ClearColor);
+
+    ImGuiApp_ImplSoftware_SetupTriangles(app, draw_data);
+    ImGuiApp_ImplSoftware_BinTriangles(app);
+
+    // Rasterize tiles on all threads
+    app->TileNext = 0;
+    if (app->Threads.Size > 0)
+    {
+        std::lock_guard<std::mutex> lock(app->Mutex);
+        app->WorkGeneration++;
+        app->WorkersBusy = app->Threads.Size;
+    }
+    app->WorkCond.notify_all();
+    ImGuiApp_ImplSoftware_RasterizeTiles(app);
+    std::unique_lock<std::mutex> lock(app->Mutex);
+    app->DoneCond.wait(lock, [&]() { return app->WorkersBusy == 0; });
+}
+
+static void ImGuiApp_ImplSoftware_Render(ImGuiApp* app_opaque)
+{
+    ImGuiApp_ImplSoftware* app = (ImGuiApp_ImplSoftware*)app_opaque;
+    ImDrawData* draw_data = ImGui::GetDrawData();
+
+#ifdef IMGUI_HAS_VIEWPORT
+    ImGuiIO& io = ImGui::GetIO();
+    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+    {
+        ImGui::UpdatePlatformWindows();
+        ImGui::RenderPlatformWindowsDefault();
+    }
+#endif
+
+    ImGuiApp_ImplSoftware_RenderDrawData(app, draw_data);
+}
+
+static bool ImGuiApp_ImplSoftware_CaptureFramebuffer(ImGuiApp* app_opaque, int x, int y, int w, int h, unsigned int* pixels, void* user_data)
+{
+    ImGuiApp_ImplSoftware* app = (ImGuiApp_ImplSoftware*)app_opaque;
+    IM_UNUSED(user_data);
+
+    // Output RGBA8 in memory. Areas outside of framebuffer are transparent black.
+    for (int py = 0; py < h; py++)
+    {
+        unsigned int* dst = pixels + (size_t)py * w;
+        const int fb_y = y + py;
+        for (int px = 0; px < w; px++)
+        {
+            const int fb_x = x + px;
+            ImU32 col = 0;
+            if (fb_x >= 0 && fb_y >= 0 && fb_x < app->FramebufferWidth && fb_y < app->FramebufferHeight)
+                col = app->Framebuffer.Data[(size_t)fb_y * app->FramebufferWidth + fb_x];
+            const ImU32 r = (col >> IM_COL32_R_SHIFT) & 0xFF, g = (col >> IM_COL32_G_SHIFT) & 0xFF, b = (col >> IM_COL32_B_SHIFT) & 0xFF, a = (col >> IM_COL32_A_SHIFT) & 0xFF;
+            dst[px] = r | (g << 8) | (b << 16) | (a << 24);
+        }
+    }
+    return true;
+}
+
+ImGuiApp* ImGuiApp_ImplSoftware_Create()
+{
+    ImGuiApp_ImplSoftware* intf = new ImGuiApp_ImplSoftware();
+    intf->InitCreateWindow      = ImGuiApp_ImplNull_CreateWindow;
+    intf->InitBackends          = ImGuiApp_ImplSoftware_InitBackends;
+    intf->NewFrame              = ImGuiApp_ImplSoftware_NewFrame;
+    intf->Render                = ImGuiApp_ImplSoftware_Render;
+    intf->ShutdownCloseWindow   = [](ImGuiApp* app) { IM_UNUSED(app); };
+    intf->ShutdownBackends      = ImGuiApp_ImplSoftware_ShutdownBackends;
+    intf->CaptureFramebuffer    = ImGuiApp_ImplSoftware_CaptureFramebuffer;
+    intf->Destroy               = [](ImGuiApp* app) { delete (ImGuiApp_ImplSoftware*)app; };
+    return intf;
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiApp Implementation: Win32 + DX11
@@ -31,6 +31,8 @@ struct ImGuiApp
     bool    MockViewports = false;                      // [In]  InitBackends()
     float   DpiScale = 1.0f;                            // [Out] InitCreateWindow() / NewFrame()
     bool    Vsync = true;                               // [Out] Render()
+    float   FixedDeltaTime = 0.0f;                      // [In]  NewFrame() Null backend only: when non-zero, use as io.DeltaTime instead of wall clock.
+    int     SoftwareRendererThreads = 0;                // [In]  InitBackends() Software backend only: number of rasterizing threads (0: number of hardware threads).
 
     bool    (*InitCreateWindow)(ImGuiApp* app, const char* window_title, ImVec2 window_size) = nullptr;
     void    (*InitBackends)(ImGuiApp* app) = nullptr;
@@ -81,6 +83,7 @@ ImGuiApp* ImGuiApp_ImplGlfwGL3_Create();
 
 // Dummy/Null Backend (last one in list so its only the default when there are no other backends compiled in)
 ImGuiApp* ImGuiApp_ImplNull_Create();
+ImGuiApp* ImGuiApp_ImplSoftware_Create();       // Null Backend + CPU rasterizer (no window, but screen captures work)
 #ifndef ImGuiApp_ImplDefault_Create
 #define ImGuiApp_ImplDefault_Create ImGuiApp_ImplNull_Create
 #endif